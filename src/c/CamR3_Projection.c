@@ -0,0 +1,313 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : CamR3_Projection.c
+   Author   : agent
+
+   Last revision: 12h58 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/R3.h>
+#include <karambola/FastMath.h>
+#include "CamR3_Projection.h"
+#include "Kernel3D.h"
+#include "Config.h"
+
+
+static inline
+void
+CamR3_Projection_row
+( float       row[4]
+, const float k
+, const R3   *axis
+, const R3   *viewPoint
+)
+{
+  row[0] = k * axis->x ;
+  row[1] = k * axis->y ;
+  row[2] = k * axis->z ;
+  row[3] = -k * R3_dotProduct( axis, viewPoint ) ;
+}
+
+
+// plane = sign * row + kDepth * depthRow + (0, 0, 0, offset), normalized.
+static
+void
+CamR3_Projection_plane
+( float        plane[4]
+, const float  sign
+, const float  row[4]
+, const float  kDepth
+, const float  offset
+, const float  depthRow[4]
+)
+{
+  for ( uint8_t i = 0  ;  i < 4  ;  ++i )
+    plane[i] = sign * row[i] + kDepth * depthRow[i] ;
+
+  plane[3] += offset ;
+
+  const float modulus2 = plane[0]*plane[0] + plane[1]*plane[1] + plane[2]*plane[2] ;
+
+  if (modulus2 > 0.0f)
+  {
+    const float invModulus = 1.0f / FastMath_sqrt( modulus2 ) ;
+
+    for ( uint8_t i = 0  ;  i < 4  ;  ++i )
+      plane[i] *= invModulus ;
+  }
+}
+
+
+// Screen side the film spans until measured: CamR3_view( ) film is taken as [-0.5, +0.5] of the shortest side, Y up.
+static
+void
+CamR3_Projection_filmAssumed
+( CamR3_Projection *this
+, const int         w
+, const int         h
+)
+{
+  const float side = (w < h) ? w : h ;
+
+  this->filmScale[0]  = +side ;
+  this->filmScale[1]  = -side ;
+  this->filmOffset[0] = 0.5f * w ;
+  this->filmOffset[1] = 0.5f * h ;
+}
+
+
+void
+CamR3_Projection_update
+( CamR3_Projection *this
+, const CamR3      *cam
+, const int         w
+, const int         h
+)
+{
+  if (this->w == w  &&  this->h == h  &&  memcmp( &this->cam, cam, sizeof(CamR3) ) == 0)
+    return ;
+
+  if (this->filmW != w  ||  this->filmH != h)
+  {
+    CamR3_Projection_filmAssumed( this, w, h ) ;
+    this->filmW = this->filmH = 0 ;
+  }
+
+  this->cam            = *cam ;
+  this->w              = w ;
+  this->h              = h ;
+  this->centerX        = (int16_t)this->filmOffset[0] ;
+  this->centerY        = (int16_t)this->filmOffset[1] ;
+  this->projectionMode = cam->projectionMode ;
+
+  // The camera looks at the world origin (CamR3_lookAtOriginUpwards( )): front is where the origin is, along zAxisVersor.
+  const float front = (R3_dotProduct( &cam->zAxisVersor, &cam->viewPoint ) > 0.0f) ? -1.0f : +1.0f ;
+
+  // Package camera, probed one unit in front of the viewpoint, on axis and one unit off along X & Y:
+  //   film = offset + ratio * (X . d) / (Z . d) (perspective), offset + ratio * (X . d) (isometric), d = p - viewPoint.
+  const R3 *vp = &cam->viewPoint, *ax = &cam->xAxisVersor, *ay = &cam->yAxisVersor, *az = &cam->zAxisVersor ;
+  const R3  p0 = { .x = vp->x + front*az->x, .y = vp->y + front*az->y, .z = vp->z + front*az->z } ;
+  const R3  p1 = { .x = p0.x + ax->x + ay->x, .y = p0.y + ax->y + ay->y, .z = p0.z + ax->z + ay->z } ;
+  R2        film0, film1 ;
+
+  CamR3_view( &film0, cam, &p0 ) ;
+  CamR3_view( &film1, cam, &p1 ) ;
+
+  // Ratios & offsets in screen units, the fractional part of the center folded into the offsets.
+  const float kZ      = (cam->projectionMode == CAM_PROJECTION_PERSPECTIVE) ? front : 1.0f ;
+  const float ratioX  = this->filmScale[0] * kZ * (film1.x - film0.x) ;
+  const float ratioY  = this->filmScale[1] * kZ * (film1.y - film0.y) ;
+  const float offsetX = this->filmScale[0] * film0.x + (this->filmOffset[0] - this->centerX) ;
+  const float offsetY = this->filmScale[1] * film0.y + (this->filmOffset[1] - this->centerY) ;
+
+  // Depth: distance in front of the camera.
+  CamR3_Projection_row( this->z, front, &cam->zAxisVersor, &cam->viewPoint ) ;
+
+  if (cam->projectionMode == CAM_PROJECTION_PERSPECTIVE)
+  {
+    CamR3_Projection_row( this->x, ratioX, &cam->xAxisVersor, &cam->viewPoint ) ;
+    CamR3_Projection_row( this->y, ratioY, &cam->yAxisVersor, &cam->viewPoint ) ;
+
+    // (X . d) / depth + offset  =  (X . d + offset * depth) / depth
+    for ( uint8_t i = 0  ;  i < 4  ;  ++i )
+    {
+      this->x[i] += offsetX * this->z[i] ;
+      this->y[i] += offsetY * this->z[i] ;
+    }
+  }
+  else
+  {
+    CamR3_Projection_row( this->x, ratioX, &cam->xAxisVersor, &cam->viewPoint ) ;
+    CamR3_Projection_row( this->y, ratioY, &cam->yAxisVersor, &cam->viewPoint ) ;
+    this->x[3] += offsetX ;
+    this->y[3] += offsetY ;
+  }
+
+  // Screen x in [0, w] <=> -centerX <= X.p <= (w - centerX), scaled by Z.p (depth) in perspective.
+  const float kDepth = (cam->projectionMode == CAM_PROJECTION_PERSPECTIVE) ? 1.0f : 0.0f ;
+  const float kW     = 1.0f - kDepth ;
+
+  CamR3_Projection_plane( this->frustum[0], +1.0f, this->x, kDepth *  this->centerX     , kW *  this->centerX      , this->z ) ;
+  CamR3_Projection_plane( this->frustum[1], -1.0f, this->x, kDepth * (w - this->centerX), kW * (w - this->centerX) , this->z ) ;
+  CamR3_Projection_plane( this->frustum[2], +1.0f, this->y, kDepth *  this->centerY     , kW *  this->centerY      , this->z ) ;
+  CamR3_Projection_plane( this->frustum[3], -1.0f, this->y, kDepth * (h - this->centerY), kW * (h - this->centerY) , this->z ) ;
+}
+
+
+bool
+CamR3_Projection_calibrate
+( CamR3_Projection *this
+, GContext         *gCtx
+, MeshR3           *mesh
+, const CamR3      *cam
+, const int         w
+, const int         h
+)
+{
+  if ((this->filmW == w  &&  this->filmH == h)  ||  mesh == NULL  ||  mesh->verticesNum == 0)
+    return false ;
+
+  // The package writes the screen point of each vertex it projects: the others keep this mark.
+  const GPoint unset = GPoint( INT16_MIN, INT16_MIN ) ;
+
+  for ( uint16_t v = 0  ;  v < mesh->verticesNum  ;  ++v )
+    __MeshR3_vertex_screenPoint[v] = unset ;
+
+  MeshR3_draw( gCtx, mesh, cam, w, h, MESH_TRANSPARENCY_SOLID ) ;
+
+  // Least squares, per screen axis: screen = offset + scale * film.
+  float    sumF[2] = { 0.0f, 0.0f }, sumS[2] = { 0.0f, 0.0f }, sumFF[2] = { 0.0f, 0.0f }, sumFS[2] = { 0.0f, 0.0f } ;
+  uint16_t n       = 0 ;
+
+  for ( uint16_t v = 0  ;  v < mesh->verticesNum  ;  ++v )
+  {
+    const GPoint screen = __MeshR3_vertex_screenPoint[v] ;
+
+    if (gpoint_equal( &screen, &unset ))
+      continue ;
+
+    R2 film ;
+    CamR3_view( &film, cam, &mesh->vertices[v].worldCoord ) ;
+
+    const float f[2] = { film.x, film.y } ;
+    const float s[2] = { screen.x, screen.y } ;
+
+    for ( uint8_t a = 0  ;  a < 2  ;  ++a )
+    {
+      sumF [a] += f[a] ;
+      sumS [a] += s[a] ;
+      sumFF[a] += f[a] * f[a] ;
+      sumFS[a] += f[a] * s[a] ;
+    }
+
+    ++n ;
+  }
+
+  for ( uint8_t a = 0  ;  a < 2  ;  ++a )
+  {
+    const float det = n * sumFF[a] - sumF[a] * sumF[a] ;
+
+    if (n < 2  ||  det == 0.0f)
+    {
+      LOGW( "CamR3_Projection_calibrate:: %d points seen, film to screen stays assumed", n ) ;
+      return false ;
+    }
+
+    this->filmScale [a] = (n * sumFS[a] - sumF[a] * sumS[a]) / det ;
+    this->filmOffset[a] = (sumS[a] - this->filmScale[a] * sumF[a]) / n ;
+  }
+
+  this->filmW = w ;
+  this->filmH = h ;
+  this->w     = 0 ;   // Re-derive.
+  CamR3_Projection_update( this, cam, w, h ) ;
+
+  // Point for point check of the derived matrix against the package.
+  GPoint *screen = malloc( mesh->verticesNum * sizeof(GPoint) ) ;
+
+  if (screen == NULL)
+    return true ;
+
+  for ( uint16_t v = 0  ;  v < mesh->verticesNum  ;  ++v )
+    mesh->vertices[v].state.isHidden = gpoint_equal( &__MeshR3_vertex_screenPoint[v], &unset ) ;
+
+  CamR3_Projection_vertices( this, mesh->vertices, mesh->verticesNum, screen ) ;
+  this->filmErrorPx = 0 ;
+
+  for ( uint16_t v = 0  ;  v < mesh->verticesNum  ;  ++v )
+    if (!mesh->vertices[v].state.isHidden)
+    {
+      const int dx = abs( screen[v].x - __MeshR3_vertex_screenPoint[v].x ) ;
+      const int dy = abs( screen[v].y - __MeshR3_vertex_screenPoint[v].y ) ;
+
+      if (dx > this->filmErrorPx)  this->filmErrorPx = dx ;
+      if (dy > this->filmErrorPx)  this->filmErrorPx = dy ;
+    }
+
+  free( screen ) ;
+
+  LOGI( "CamR3_Projection_calibrate:: %dx%d, scale = (%d, %d)/1000, offset = (%d, %d)/1000, %d points, error = %d px"
+      , w, h, (int)(1000 * this->filmScale[0]), (int)(1000 * this->filmScale[1])
+      , (int)(1000 * this->filmOffset[0]), (int)(1000 * this->filmOffset[1]), n, this->filmErrorPx
+      ) ;
+
+  return true ;
+}
+
+
+bool
+CamR3_Projection_isSphereVisible
+( const CamR3_Projection *this
+, const R3               *center
+, const float             radius
+)
+{
+  for ( uint8_t i = 0  ;  i < 4  ;  ++i )
+  {
+    const float *plane = this->frustum[i] ;
+
+    if (plane[0]*center->x + plane[1]*center->y + plane[2]*center->z + plane[3] < -radius)
+      return false ;
+  }
+
+  // Perspective: wholly behind the near plane ?
+  return this->projectionMode != CAM_PROJECTION_PERSPECTIVE
+      || this->z[0]*center->x + this->z[1]*center->y + this->z[2]*center->z + this->z[3] >= CAMR3_PROJECTION_NEAR - radius ;
+}
+
+
+bool
+CamR3_Projection_isSphereNear
+( const CamR3_Projection *this
+, const R3               *center
+, const float             radius
+)
+{
+  return this->projectionMode == CAM_PROJECTION_PERSPECTIVE
+      && this->z[0]*center->x + this->z[1]*center->y + this->z[2]*center->z + this->z[3] < CAMR3_PROJECTION_NEAR + radius ;
+}
+
+
+void
+CamR3_Projection_vertices
+( const CamR3_Projection *this
+, const Vertex           *vertices
+, const uint16_t          verticesNum
+, GPoint                 *screenPoints
+)
+{
+  if (verticesNum == 0)
+    return ;
+
+  if (this->projectionMode == CAM_PROJECTION_PERSPECTIVE)
+    Kernel3D_projectPerspective( this->x, this->y, this->z, this->centerX, this->centerY
+                               , &vertices->worldCoord, &vertices->state, sizeof(Vertex), verticesNum
+                               , screenPoints
+                               ) ;
+  else
+    Kernel3D_projectIsometric( this->x, this->y, this->centerX, this->centerY
+                             , &vertices->worldCoord, &vertices->state, sizeof(Vertex), verticesNum
+                             , screenPoints
+                             ) ;
+}
@@ -0,0 +1,82 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : CamR3_Projection.h
+   Author   : agent
+
+   Last revision: 12h56 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/CamR3.h>
+#include <karambola/MeshR3.h>
+
+
+// Fused world -> screen transformation, derived once per camera (or screen size) change.
+//   perspective: screen = center + (X . p + X0, Y . p + Y0) / (Z . p + Z0)
+//   isometric  : screen = center + (X . p + X0, Y . p + Y0)
+// The camera part is taken from the package itself: CamR3_view( ) is probed at two points per camera change.
+// Film to screen (screen = filmOffset + filmScale * film) is measured on the package own drawing of a mesh
+// (see CamR3_Projection_calibrate( )), assumed to span the shortest screen side until then.
+// Z . p + Z0 is the depth in front of the camera, in world units.
+typedef struct
+{ float              x[4] ;
+  float              y[4] ;
+  float              z[4] ;
+  int16_t            centerX, centerY ;
+  CamProjectionMode  projectionMode ;
+
+  float              frustum[4][4] ;   // Left, right, top & bottom side planes: unit normals pointing inwards.
+
+  float              filmScale[2] ;
+  float              filmOffset[2] ;
+  int16_t            filmW, filmH ;    // Screen size the film mapping was measured for (0: not measured).
+  uint8_t            filmErrorPx ;     // Largest deviation from the package seen at measurement.
+
+  CamR3              cam ;          // Camera & screen the matrix was derived from.
+  int16_t            w, h ;
+} CamR3_Projection ;
+
+
+// Perspective: points closer than this in front of the camera are not projected (world units: the cube side is 1).
+#define  CAMR3_PROJECTION_NEAR   0.05f
+
+
+// Re-derives the matrix only if camera or screen size changed since last call.
+void  CamR3_Projection_update( CamR3_Projection *this, const CamR3 *cam, const int w, const int h ) ;
+
+// Measures film to screen on a package MeshR3_draw( ) of mesh (which it draws), then checks the derived matrix
+// point for point against it. Once per screen size: true if the mapping was (re)measured, and so has changed.
+bool
+CamR3_Projection_calibrate
+( CamR3_Projection *this
+, GContext         *gCtx
+, MeshR3           *mesh
+, const CamR3      *cam
+, const int         w
+, const int         h
+) ;
+
+// False if the sphere lies entirely outside (at least) one of the frustum side planes, or behind the near plane.
+bool  CamR3_Projection_isSphereVisible( const CamR3_Projection *this, const R3 *center, const float radius ) ;
+
+// Perspective: does part of the sphere come closer than CAMR3_PROJECTION_NEAR ? (then check each vertex)
+bool  CamR3_Projection_isSphereNear( const CamR3_Projection *this, const R3 *center, const float radius ) ;
+
+static inline
+bool
+CamR3_Projection_isBehindNear
+( const CamR3_Projection *this
+, const R3               *p
+)
+{ return this->z[0]*p->x + this->z[1]*p->y + this->z[2]*p->z + this->z[3] < CAMR3_PROJECTION_NEAR ; }
+
+// Projects the vertices not flagged as hidden, writing their screen points (same index) to screenPoints.
+void
+CamR3_Projection_vertices
+( const CamR3_Projection *this
+, const Vertex           *vertices
+, const uint16_t          verticesNum
+, GPoint                 *screenPoints
+) ;
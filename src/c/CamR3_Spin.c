@@ -0,0 +1,74 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : CamR3_Spin.c
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/R3.h>
+#include "CamR3_Spin.h"
+
+
+static inline
+void
+R3_rotateZ
+( R3          *v
+, const float  sinA
+, const float  cosA
+)
+{
+  const float x = v->x ;
+  v->x = cosA * x - sinA * v->y ;
+  v->y = sinA * x + cosA * v->y ;
+}
+
+
+CamR3*
+CamR3_rotateZ
+( CamR3       *cam
+, const float  sinA
+, const float  cosA
+)
+{
+  R3_rotateZ( &cam->viewPoint  , sinA, cosA ) ;
+  R3_rotateZ( &cam->xAxisVersor, sinA, cosA ) ;
+  R3_rotateZ( &cam->yAxisVersor, sinA, cosA ) ;
+  R3_rotateZ( &cam->zAxisVersor, sinA, cosA ) ;
+
+  return cam ;
+}
+
+
+CamR3*
+CamR3_orthonormalize
+( CamR3       *cam
+, const float  distanceFromOrigin
+)
+{
+  R3 *x = &cam->xAxisVersor ;
+  R3 *y = &cam->yAxisVersor ;
+  R3 *z = &cam->zAxisVersor ;
+
+  // Gram-Schmidt: z stays the reference direction.
+  R3_versor( z ) ;
+
+  R3 xAlongZ ;
+  R3_scalarProduct( &xAlongZ, R3_dotProduct( x, z ), z ) ;
+  R3_versor( R3_sub( x, x, &xAlongZ ) ) ;
+
+  R3 yNew ;
+  R3_crossProduct( &yNew, z, x ) ;
+
+  if (R3_dotProduct( &yNew, y ) < 0.0f)   // Keep the original handedness.
+    R3_scalarProduct( &yNew, -1.0f, &yNew ) ;
+
+  *y = yNew ;
+
+  // The camera looks at the origin: viewpoint lies on the z axis line, at the given distance.
+  const float sign = (R3_dotProduct( &cam->viewPoint, z ) < 0.0f) ? -1.0f : +1.0f ;
+  R3_scalarProduct( &cam->viewPoint, sign * distanceFromOrigin, z ) ;
+
+  return cam ;
+}
@@ -0,0 +1,20 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : CamR3_Spin.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <karambola/CamR3.h>
+
+
+// Incremental camera update for a pure spin around the world Z axis: rotates the viewpoint and
+// the x/y/z axis versors by the given sin/cos pair (no normalization, cross products or sqrt).
+CamR3*  CamR3_rotateZ( CamR3 *cam, const float sinA, const float cosA ) ;
+
+// Counters rounding drift of repeated CamR3_rotateZ( ): re-orthonormalizes the axis versors
+// (keeping their handedness) and re-aligns the viewpoint with the (looking at origin) z axis.
+CamR3*  CamR3_orthonormalize( CamR3 *cam, const float distanceFromOrigin ) ;
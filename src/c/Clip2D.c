@@ -0,0 +1,192 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Clip2D.c
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/FastMath.h>
+#include "Clip2D.h"
+
+
+#define  OUT_LEFT    1
+#define  OUT_RIGHT   2
+#define  OUT_TOP     4
+#define  OUT_BOTTOM  8
+
+static int           s_xMax, s_yMax ;   // Inclusive viewport bounds, min bounds are 0.
+static Clip2D_Stats  s_stats ;
+
+#ifdef PBL_ROUND
+static int           s_cx, s_cy ;       // Display circle center.
+static int32_t       s_r2 ;             // Display circle squared radius.
+#endif
+
+
+void
+Clip2D_beginFrame
+( const int w
+, const int h
+)
+{
+  s_xMax  = w - 1 ;
+  s_yMax  = h - 1 ;
+  s_stats = (Clip2D_Stats){ 0 } ;
+
+#ifdef PBL_ROUND
+  const int r = ((w < h) ? w : h) >> 1 ;
+  s_cx = w >> 1 ;
+  s_cy = h >> 1 ;
+  s_r2 = (int32_t)r * r ;
+#endif
+}
+
+
+const Clip2D_Stats*
+Clip2D_getStats
+( )
+{ return &s_stats ; }
+
+
+static inline
+uint8_t
+Clip2D_outCode
+( const int x
+, const int y
+)
+{
+  return ((x < 0)      ? OUT_LEFT   : (x > s_xMax) ? OUT_RIGHT  : 0)
+       | ((y < 0)      ? OUT_TOP    : (y > s_yMax) ? OUT_BOTTOM : 0) ;
+}
+
+
+// Cohen-Sutherland against the viewport rectangle.
+static
+bool
+Clip2D_rect
+( GPoint *p0
+, GPoint *p1
+)
+{
+  uint8_t out0 = Clip2D_outCode( p0->x, p0->y ) ;
+  uint8_t out1 = Clip2D_outCode( p1->x, p1->y ) ;
+
+  while (out0 | out1)
+  {
+    if (out0 & out1)
+      return false ;
+
+    const uint8_t out = out0 ? out0 : out1 ;
+    const int     dx  = p1->x - p0->x ;
+    const int     dy  = p1->y - p0->y ;
+    int x, y ;
+
+    if (out & OUT_BOTTOM)
+    { y = s_yMax ; x = p0->x + dx * (s_yMax - p0->y) / dy ; }
+    else if (out & OUT_TOP)
+    { y = 0      ; x = p0->x + dx * (0      - p0->y) / dy ; }
+    else if (out & OUT_RIGHT)
+    { x = s_xMax ; y = p0->y + dy * (s_xMax - p0->x) / dx ; }
+    else
+    { x = 0      ; y = p0->y + dy * (0      - p0->x) / dx ; }
+
+    if (out == out0)
+    { *p0 = GPoint( x, y ) ; out0 = Clip2D_outCode( x, y ) ; }
+    else
+    { *p1 = GPoint( x, y ) ; out1 = Clip2D_outCode( x, y ) ; }
+  }
+
+  return true ;
+}
+
+
+#ifdef PBL_ROUND
+static inline
+bool
+Clip2D_isInCircle
+( const GPoint *p )
+{
+  const int32_t dx = p->x - s_cx ;
+  const int32_t dy = p->y - s_cy ;
+
+  return dx*dx + dy*dy <= s_r2 ;
+}
+
+
+// Trims the segment to the display circle: solves |p0 + t.(p1-p0) - c|^2 = r^2 for t in [0,1].
+static
+bool
+Clip2D_circle
+( GPoint *p0
+, GPoint *p1
+)
+{
+  const bool in0 = Clip2D_isInCircle( p0 ) ;
+  const bool in1 = Clip2D_isInCircle( p1 ) ;
+
+  if (in0  &&  in1)
+    return true ;
+
+  const float dx = p1->x - p0->x ;
+  const float dy = p1->y - p0->y ;
+  const float fx = p0->x - s_cx ;
+  const float fy = p0->y - s_cy ;
+  const float a  = dx*dx + dy*dy ;
+  const float b  = fx*dx + fy*dy ;
+  const float c  = fx*fx + fy*fy - s_r2 ;
+  const float disc = b*b - a*c ;
+
+  if (a == 0.0f  ||  disc < 0.0f)
+    return false ;
+
+  const float sqrtDisc = FastMath_sqrt( disc ) ;
+  float t0 = (-b - sqrtDisc) / a ;
+  float t1 = (-b + sqrtDisc) / a ;
+
+  if (t0 < 0.0f)  t0 = 0.0f ;
+  if (t1 > 1.0f)  t1 = 1.0f ;
+
+  if (t0 >= t1)
+    return false ;
+
+  const GPoint start = *p0 ;
+
+  if (!in0)
+    *p0 = GPoint( start.x + (int)(t0 * dx), start.y + (int)(t0 * dy) ) ;
+
+  if (!in1)
+    *p1 = GPoint( start.x + (int)(t1 * dx), start.y + (int)(t1 * dy) ) ;
+
+  return true ;
+}
+#endif
+
+
+bool
+Clip2D_segment
+( GPoint *p0
+, GPoint *p1
+)
+{
+  const GPoint q0 = *p0 ;
+  const GPoint q1 = *p1 ;
+
+  if ( !Clip2D_rect( p0, p1 )
+#ifdef PBL_ROUND
+    || !Clip2D_circle( p0, p1 )
+#endif
+     )
+  {
+    ++s_stats.rejected ;
+    return false ;
+  }
+
+  if (gpoint_equal( &q0, p0 )  &&  gpoint_equal( &q1, p1 ))
+    ++s_stats.accepted ;
+  else
+    ++s_stats.clipped ;
+
+  return true ;
+}
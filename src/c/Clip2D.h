@@ -0,0 +1,28 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Clip2D.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+typedef struct
+{ uint16_t  accepted ;   // Fully visible, untouched.
+  uint16_t  clipped ;    // Partially visible, trimmed to the viewport.
+  uint16_t  rejected ;   // Fully outside the viewport, not to be drawn.
+} Clip2D_Stats ;
+
+
+// Sets the viewport (unobstructed screen rectangle, further bounded by the display circle on round platforms)
+// and resets the per frame counters.
+void  Clip2D_beginFrame( const int w, const int h ) ;
+
+// Trims the segment to the viewport. Returns false if nothing of it is visible.
+bool  Clip2D_segment( GPoint *p0, GPoint *p1 ) ;
+
+const Clip2D_Stats*  Clip2D_getStats( ) ;
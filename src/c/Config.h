@@ -14,6 +14,9 @@
 // Commenting the next line will enable antialised and thick strokes.
 //#define QEMU
 
+// Uncommenting the next line will run the startup benchmarks (results are LOG'ed: enable LOG too).
+//#define BENCHMARK
+
 // Uncoment next line to "fake" running on APLITE/DIORITE B&W platforms.
 //#undef PBL_COLOR
 
@@ -0,0 +1,131 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DigitPlacement.c
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/Clock3D.h>
+#include "DigitPlacement.h"
+#include "DigitTemplates.h"
+#include "Config.h"
+
+
+#define  DIGITPLACEMENT_FIT_EPSILON  (0.001f * CUBE_SIZE)
+
+
+static inline
+R3*
+DigitPlacement_at
+( const DigitPlacement *this
+, R3                   *world
+, const I2_8           *point
+)
+{
+  world->x = this->origin.x + point->x * this->axisX.x + point->y * this->axisY.x ;
+  world->y = this->origin.y + point->x * this->axisX.y + point->y * this->axisY.y ;
+  world->z = this->origin.z + point->x * this->axisX.z + point->y * this->axisY.z ;
+
+  return world ;
+}
+
+
+// Recovers the template to world affine map of a digit from 3 of its vertices, then checks it against all of them.
+bool
+DigitPlacement_fit
+( DigitPlacement *this
+, const Digit3D  *digit
+)
+{
+  if ( digit == NULL  ||  digit->mesh == NULL
+    || digit->type >= DIGIT2D_TYPES_NUM
+    || digit->mesh->edgeInfo != DIGIT_TEMPLATES[digit->type].edgeInfo
+     )
+    return false ;
+
+  const I2_8     *points    = DIGIT_TEMPLATES[digit->type].vertexInfo->points ;
+  const uint16_t  pointsNum = DIGIT_TEMPLATES[digit->type].vertexInfo->pointsNum ;
+  const Vertex   *vertices  = digit->mesh->vertices ;
+
+  if (digit->mesh->verticesNum < pointsNum  ||  pointsNum < 3)
+    return false ;
+
+  // Well conditioned triangle: farthest point from the first, then farthest from that line.
+  uint16_t i1 = 0, i2 = 0 ;
+  int32_t  best = 0 ;
+
+  for ( uint16_t i = 1  ;  i < pointsNum  ;  ++i )
+  {
+    const int32_t dx = points[i].x - points[0].x, dy = points[i].y - points[0].y ;
+
+    if (dx*dx + dy*dy > best)  { best = dx*dx + dy*dy ; i1 = i ; }
+  }
+
+  const int32_t ux = points[i1].x - points[0].x, uy = points[i1].y - points[0].y ;
+  best = 0 ;
+
+  for ( uint16_t i = 1  ;  i < pointsNum  ;  ++i )
+  {
+    const int32_t cross = abs( ux * (points[i].y - points[0].y) - uy * (points[i].x - points[0].x) ) ;
+
+    if (cross > best)  { best = cross ; i2 = i ; }
+  }
+
+  if (best == 0)
+    return false ;
+
+  const int32_t vx  = points[i2].x - points[0].x, vy = points[i2].y - points[0].y ;
+  const float   det = (float)(ux * vy - uy * vx) ;
+
+  R3 du, dv ;
+  R3_sub( &du, &vertices[i1].worldCoord, &vertices[0].worldCoord ) ;
+  R3_sub( &dv, &vertices[i2].worldCoord, &vertices[0].worldCoord ) ;
+
+  // [axisX axisY] = [du dv] * inverse([u v])
+  this->axisX = (R3){ .x = (du.x * vy - dv.x * uy) / det, .y = (du.y * vy - dv.y * uy) / det, .z = (du.z * vy - dv.z * uy) / det } ;
+  this->axisY = (R3){ .x = (dv.x * ux - du.x * vx) / det, .y = (dv.y * ux - du.y * vx) / det, .z = (dv.z * ux - du.z * vx) / det } ;
+
+  this->origin = (R3){ .x = vertices[0].worldCoord.x - points[0].x * this->axisX.x - points[0].y * this->axisY.x
+                          , .y = vertices[0].worldCoord.y - points[0].x * this->axisX.y - points[0].y * this->axisY.y
+                          , .z = vertices[0].worldCoord.z - points[0].x * this->axisX.z - points[0].y * this->axisY.z
+                          } ;
+
+  // The package vertex order MUST match the template point order, otherwise there is no placement.
+  for ( uint16_t i = 0  ;  i < pointsNum  ;  ++i )
+  {
+    R3 error ;
+    R3_sub( &error, DigitPlacement_at( this, &error, points + i ), &vertices[i].worldCoord ) ;
+
+    if (R3_dotProduct( &error, &error ) > DIGITPLACEMENT_FIT_EPSILON * DIGITPLACEMENT_FIT_EPSILON)
+      return false ;
+  }
+
+  if ((this->hasNormal = (digit->mesh->normal_worldCoord != NULL)))
+    this->normal = *digit->mesh->normal_worldCoord ;
+
+  return true ;
+}
+
+
+// Rewrites the digit template vertices (and normals) at a placement.
+void
+DigitPlacement_apply
+( const DigitPlacement *this
+, MeshR3               *mesh
+, const Digit2D_Type    type
+)
+{
+  const I2_8     *points    = DIGIT_TEMPLATES[type].vertexInfo->points ;
+  const uint16_t  pointsNum = DIGIT_TEMPLATES[type].vertexInfo->pointsNum ;
+
+  for ( uint16_t i = 0  ;  i < pointsNum  &&  i < mesh->verticesNum  ;  ++i )
+    DigitPlacement_at( this, &mesh->vertices[i].worldCoord, points + i ) ;
+
+  if (this->hasNormal  &&  mesh->normal_worldCoord != NULL)
+    *mesh->normal_worldCoord = this->normal ;
+
+  if (mesh->facesNum > 0)
+    MeshR3_calculateFaceNormals( mesh ) ;
+}
@@ -0,0 +1,32 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DigitPlacement.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/R3.h>
+#include <karambola/Digit3D.h>
+
+
+// Where a configured digit sits in the world: world = origin + point.x * axisX + point.y * axisY,
+// point in template (I2_8) units. All Digit2D types share the template grid, so a placement recovered
+// from a digit of one type places any other type at the same spot.
+typedef struct
+{ R3    origin ;
+  R3    axisX ;
+  R3    axisY ;
+  R3    normal ;        // Mesh plane normal, as configured by the package.
+  bool  hasNormal ;
+} DigitPlacement ;
+
+
+// Recovered from the current digit vertices. false if the mesh is not a plain affine image of its type template.
+bool  DigitPlacement_fit  ( DigitPlacement *this, const Digit3D *digit ) ;
+
+// Rewrites the template vertices of a type (and the mesh normals) at the placement.
+void  DigitPlacement_apply( const DigitPlacement *this, MeshR3 *mesh, const Digit2D_Type type ) ;
@@ -0,0 +1,327 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DigitSwitch.c
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#include <pebble.h>
+#include "DigitSwitch.h"
+#include "DigitPlacement.h"
+#include "DigitTemplates.h"
+#include "RadialDial3D_Incremental.h"
+#include "TimeMs.h"
+#include "Config.h"
+
+
+#define  DIGITSWITCH_DIGITS_MAX   14               // days 4, hours 4, minutes 4, seconds 2.
+
+
+static Digit3D       *s_pending[DIGITSWITCH_DIGITS_MAX] ;
+static uint8_t        s_pendingNum = 0 ;
+static Digit2D_Type   s_type ;
+static Digit2D_Type   s_typeOld ;
+static bool           s_isFallback = false ;     // Last switch went through Clock3D_setDigitType( ).
+
+
+// The digits following clock->digitType, without duplicates.
+static
+uint8_t
+DigitSwitch_digits
+( Clock3D *clock
+, Digit3D *digits[DIGITSWITCH_DIGITS_MAX]
+)
+{
+  Digit3D *all[DIGITSWITCH_DIGITS_MAX] = { clock->days_leftDigitA   , clock->days_leftDigitB   , clock->days_rightDigitA   , clock->days_rightDigitB
+                                         , clock->hours_leftDigitA  , clock->hours_leftDigitB  , clock->hours_rightDigitA  , clock->hours_rightDigitB
+                                         , clock->minutes_leftDigitA, clock->minutes_leftDigitB, clock->minutes_rightDigitA, clock->minutes_rightDigitB
+                                         , clock->seconds_leftDigit , clock->seconds_rightDigit
+                                         } ;
+  uint8_t digitsNum = 0 ;
+
+  for ( uint8_t i = 0  ;  i < DIGITSWITCH_DIGITS_MAX  ;  ++i )
+  {
+    if (all[i] == NULL)
+      continue ;
+
+    uint8_t j = 0 ;
+
+    while (j < digitsNum  &&  digits[j] != all[i])
+      ++j ;
+
+    if (j == digitsNum)
+      digits[digitsNum++] = all[i] ;
+  }
+
+  return digitsNum ;
+}
+
+
+// Re-types one digit in place: new template topology, same placement, style & value.
+static
+bool
+DigitSwitch_digit
+( Digit3D            *digit
+, const Digit2D_Type  type
+)
+{
+  DigitPlacement placement ;
+
+  if (!DigitPlacement_fit( &placement, digit ))
+    return false ;
+
+  MeshR3       *mesh  = digit->mesh ;
+  const MeshR3  style = *mesh ;
+  const int8_t  value = digit->value ;
+
+  // Unit placement: only the topology is taken from the package, the geometry is rewritten below.
+  Digit3D_config( digit, type, (R2){ .x = 1.0f, .y = 1.0f }, (R2){ 0 }, (R3){ 0 }, (R3){ 0 } ) ;
+  DigitPlacement_apply( &placement, mesh, type ) ;
+
+  mesh->inkBlinker           = style.inkBlinker ;
+  mesh->strokeWidth          = style.strokeWidth ;
+  mesh->strokeColor          = style.strokeColor ;
+  mesh->strokeWidthAlternate = style.strokeWidthAlternate ;
+  mesh->strokeColorAlternate = style.strokeColorAlternate ;
+
+  // Same value, new value edge map.
+  if (value >= 0)
+  {
+    digit->value = -1 ;
+    Digit3D_setValue( digit, value ) ;
+  }
+
+  return true ;
+}
+
+
+static
+void
+DigitSwitch_end
+( Clock3D *clock )
+{
+  clock->digitType = s_type ;
+  s_pendingNum     = 0 ;
+
+  // Decoded lists of the old type, unless the second100ths face still uses them.
+  if ( s_typeOld != s_type
+    && (clock->second100ths_leftDigit == NULL  ||  clock->second100ths_leftDigit->type != s_typeOld)
+     )
+    DigitTemplates_release( s_typeOld ) ;
+}
+
+
+static
+void
+DigitSwitch_fallback
+( Clock3D *clock )
+{
+  LOGW( "DigitSwitch_fallback:: type %d can not be switched in place", s_type ) ;
+
+  s_pendingNum = 0 ;
+  s_isFallback = true ;
+  Clock3D_setDigitType( clock, s_type ) ;
+
+  // The radials may have been rebuilt too: learned again.
+  RadialDial3D_Incremental_finalize( ) ;
+  RadialDial3D_Incremental_initialize( clock ) ;
+}
+
+
+void
+DigitSwitch_begin
+( Clock3D            *clock
+, const Digit2D_Type  type
+)
+{
+  if (DigitSwitch_isPending( )  &&  type == s_type)
+    return ;
+
+  s_type       = type ;
+  s_typeOld    = clock->digitType ;
+  s_isFallback = false ;
+
+  Digit3D       *digits[DIGITSWITCH_DIGITS_MAX] ;
+  const uint8_t  digitsNum = DigitSwitch_digits( clock, digits ) ;
+
+  s_pendingNum = 0 ;
+
+  for ( uint8_t i = 0  ;  i < digitsNum  ;  ++i )
+    if (digits[i]->type != type)
+    {
+      // Allocated for a smaller type: no room to switch in place.
+      if (type > digits[i]->typeMax  ||  type >= DIGIT2D_TYPES_NUM)
+      {
+        DigitSwitch_fallback( clock ) ;
+        return ;
+      }
+
+      s_pending[s_pendingNum++] = digits[i] ;
+    }
+
+  if (s_pendingNum == 0)
+    DigitSwitch_end( clock ) ;
+}
+
+
+bool
+DigitSwitch_step
+( Clock3D *clock )
+{
+  if (s_pendingNum == 0)
+    return false ;
+
+  const uint32_t start_ms = TimeMs_now( ) ;
+
+  // At least one digit per step, then as many as the budget allows.
+  do
+  {
+    if (!DigitSwitch_digit( s_pending[--s_pendingNum], s_type ))
+    {
+      DigitSwitch_fallback( clock ) ;
+      return false ;
+    }
+  }
+  while (s_pendingNum > 0  &&  TimeMs_now( ) - start_ms < DIGITSWITCH_STEP_BUDGET_MS) ;
+
+  if (s_pendingNum == 0)
+    DigitSwitch_end( clock ) ;
+
+  return s_pendingNum > 0 ;
+}
+
+
+bool
+DigitSwitch_isPending
+( )
+{ return s_pendingNum > 0 ; }
+
+
+#ifdef BENCHMARK
+// Starting geometry of a digit: vertices, face normals & mesh normal (the values & edge maps are re-typed back).
+typedef struct
+{ R3  *worldCoords ;      // verticesNum vertices, then facesNum face normals.
+  R3   normal ;
+} DigitSwitch_Geometry ;
+
+
+static
+bool
+DigitSwitch_save
+( DigitSwitch_Geometry *this
+, const MeshR3         *mesh
+)
+{
+  if ((this->worldCoords = malloc( (mesh->verticesNum + mesh->facesNum) * sizeof(R3) )) == NULL)
+    return false ;
+
+  for ( uint16_t i = 0  ;  i < mesh->verticesNum  ;  ++i )
+    this->worldCoords[i] = mesh->vertices[i].worldCoord ;
+
+  for ( uint16_t i = 0  ;  i < mesh->facesNum  ;  ++i )
+    this->worldCoords[mesh->verticesNum + i] = mesh->faces[i].normal_worldCoord ;
+
+  if (mesh->normal_worldCoord != NULL)
+    this->normal = *mesh->normal_worldCoord ;
+
+  return true ;
+}
+
+
+static
+void
+DigitSwitch_restore
+( DigitSwitch_Geometry *this
+, MeshR3               *mesh
+)
+{
+  for ( uint16_t i = 0  ;  i < mesh->verticesNum  ;  ++i )
+    mesh->vertices[i].worldCoord = this->worldCoords[i] ;
+
+  for ( uint16_t i = 0  ;  i < mesh->facesNum  ;  ++i )
+    mesh->faces[i].normal_worldCoord = this->worldCoords[mesh->verticesNum + i] ;
+
+  if (mesh->normal_worldCoord != NULL)
+    *mesh->normal_worldCoord = this->normal ;
+
+  free( this->worldCoords ) ;
+  this->worldCoords = NULL ;
+}
+
+
+void
+DigitSwitch_benchmark
+( Clock3D *clock )
+{
+  Digit3D              *digits[DIGITSWITCH_DIGITS_MAX] ;
+  DigitSwitch_Geometry  geometry[DIGITSWITCH_DIGITS_MAX] ;
+  const uint8_t         digitsNum  = DigitSwitch_digits( clock, digits ) ;
+  const Digit2D_Type    typeStart  = clock->digitType ;
+  Digit2D_Type          typeMax    = DIGIT2D_TYPES_NUM - 1 ;
+  uint8_t               saved      = 0 ;
+  bool                  isFallback = false ;
+
+  // The placement refit of every switch may round the geometry off: the starting one is put back as it was.
+  while (saved < digitsNum  &&  DigitSwitch_save( &geometry[saved], digits[saved]->mesh ))
+    ++saved ;
+
+  if (saved < digitsNum)
+  {
+    LOGW( "DigitSwitch_benchmark:: no heap for the geometry copy, not run" ) ;
+
+    while (saved > 0)
+      free( geometry[--saved].worldCoords ) ;
+
+    return ;
+  }
+
+  for ( uint8_t i = 0  ;  i < digitsNum  ;  ++i )
+    if (digits[i]->typeMax < typeMax)
+      typeMax = digits[i]->typeMax ;
+
+  // Every type that switches in place once (the others would go through Clock3D_setDigitType( )), ending back on the starting one.
+  for ( uint8_t i = 1  ;  i <= DIGIT2D_TYPES_NUM  ;  ++i )
+  {
+    const Digit2D_Type type = (typeStart + i) % DIGIT2D_TYPES_NUM ;
+
+    if (type > typeMax)
+    {
+      LOGI( "DigitSwitch_benchmark:: type %d skipped, above typeMax %d", type, typeMax ) ;
+      continue ;
+    }
+
+    const Digit2D_Type typeFrom   = clock->digitType ;
+    const int          heapBefore = heap_bytes_used( ) ;
+    const uint32_t     start_ms   = TimeMs_now( ) ;
+    uint32_t           stepMax_ms = 0 ;
+    uint16_t           steps      = 0 ;
+
+    for ( DigitSwitch_begin( clock, type )  ;  DigitSwitch_isPending( )  ;  ++steps )
+    {
+      const uint32_t step_ms = TimeMs_now( ) ;
+      DigitSwitch_step( clock ) ;
+
+      if (TimeMs_now( ) - step_ms > stepMax_ms)
+        stepMax_ms = TimeMs_now( ) - step_ms ;
+    }
+
+    LOGI( "DigitSwitch_benchmark:: type %d -> %d: %d ms, %d steps (max %d ms), heap delta = %d%s"
+        , typeFrom, type
+        , (int)(TimeMs_now( ) - start_ms), steps, (int)stepMax_ms
+        , (int)heap_bytes_used( ) - heapBefore
+        , s_isFallback ? " (Clock3D_setDigitType fallback)" : ""
+        ) ;
+
+    isFallback = isFallback  ||  s_isFallback ;
+  }
+
+  // A fallback reallocated the digits: their starting geometry no longer applies.
+  if (isFallback)
+    for ( uint8_t i = 0  ;  i < digitsNum  ;  ++i )
+      free( geometry[i].worldCoords ) ;
+  else
+    for ( uint8_t i = 0  ;  i < digitsNum  ;  ++i )
+      DigitSwitch_restore( &geometry[i], digits[i]->mesh ) ;
+}
+#endif
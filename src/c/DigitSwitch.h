@@ -0,0 +1,33 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DigitSwitch.h
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/Clock3D.h>
+#include "Config.h"
+
+
+// Clock3D_setDigitType( ) replacement: digits are re-typed in place, inside the allocation they got for their typeMax.
+// Each digit keeps its placement (see DigitPlacement.h) and only takes the topology of the new type template.
+// The work is spread over frames: each DigitSwitch_step( ) re-types digits until DIGITSWITCH_STEP_BUDGET_MS is spent.
+
+#define  DIGITSWITCH_STEP_BUDGET_MS   8
+
+
+// Digits of the days, hours, minutes & seconds faces (second100ths have a type of their own).
+// Falls back to Clock3D_setDigitType( ) if a digit can not take the type in place.
+void  DigitSwitch_begin    ( Clock3D *clock, const Digit2D_Type type ) ;
+bool  DigitSwitch_step     ( Clock3D *clock ) ;   // true while digits are pending.
+bool  DigitSwitch_isPending( ) ;
+
+#ifdef BENCHMARK
+// Cycles through every type the digits can take in place, logging switch latency, steps & heap delta.
+// Ends back on the starting type, digit values & geometry. Not run if out of memory for the geometry copy.
+void  DigitSwitch_benchmark( Clock3D *clock ) ;
+#endif
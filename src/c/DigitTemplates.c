@@ -0,0 +1,181 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DigitTemplates.c
+   Author   : agent
+
+   Last revision: 12h53 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/Binary.h>
+#include "DigitTemplates.h"
+#include "Config.h"
+
+
+const DigitTemplate  DIGIT_TEMPLATES[DIGIT2D_TYPES_NUM]
+= { [DIGIT2D_7SEGBONE]      = { &DIGIT2D_7SEGBONE_VERTEXINFO     , &DIGIT2D_7SEGBONE_EDGEINFO     , DIGIT2D_7SEGBONE_VALUEEDGEMAP_L2R     , NULL                                }
+  , [DIGIT2D_7SEGSKIN]      = { &DIGIT2D_7SEGSKIN_VERTEXINFO     , &DIGIT2D_7SEGSKIN_EDGEINFO     , DIGIT2D_7SEGSKIN_VALUEEDGEMAP_L2R     , NULL                                }
+  , [DIGIT2D_7SEGBONESKIN]  = { &DIGIT2D_7SEGSKINBONE_VERTEXINFO , &DIGIT2D_7SEGSKINBONE_EDGEINFO , DIGIT2D_7SEGSKINBONE_VALUEEDGEMAP_L2R , &DIGIT2D_7SEGBONESKIN_BONEMASK_L2R   }
+  , [DIGIT2D_7SEGSKINBONE]  = { &DIGIT2D_7SEGSKINBONE_VERTEXINFO , &DIGIT2D_7SEGSKINBONE_EDGEINFO , DIGIT2D_7SEGSKINBONE_VALUEEDGEMAP_L2R , &DIGIT2D_7SEGSKINBONE_BONEMASK_L2R   }
+  , [DIGIT2D_CURVYBONE]     = { &DIGIT2D_CURVYBONE_VERTEXINFO    , &DIGIT2D_CURVYBONE_EDGEINFO    , DIGIT2D_CURVYBONE_VALUEEDGEMAP_L2R    , NULL                                }
+  , [DIGIT2D_CURVYSKIN]     = { &DIGIT2D_CURVYSKIN_VERTEXINFO    , &DIGIT2D_CURVYSKIN_EDGEINFO    , DIGIT2D_CURVYSKIN_VALUEEDGEMAP_L2R    , NULL                                }
+  , [DIGIT2D_CURVYSKINBONE] = { &DIGIT2D_CURVYSKINBONE_VERTEXINFO, &DIGIT2D_CURVYSKINBONE_EDGEINFO, DIGIT2D_CURVYSKINBONE_VALUEEDGEMAP_L2R, &DIGIT2D_CURVYSKINBONE_BONEMASK_L2R  }
+  , [DIGIT2D_CURVYBONESKIN] = { &DIGIT2D_CURVYSKINBONE_VERTEXINFO, &DIGIT2D_CURVYSKINBONE_EDGEINFO, DIGIT2D_CURVYSKINBONE_VALUEEDGEMAP_L2R, &DIGIT2D_CURVYBONESKIN_BONEMASK_L2R  }
+  }
+;
+
+
+// One block per type: the 10 value headers followed by their edge & vertex index lists.
+static DigitTemplates_Value  *s_values[DIGIT2D_TYPES_NUM] ;
+
+
+static inline
+void
+DigitTemplates_reference
+( unsigned char *isReferenced_L2R
+, const uint8_t  vertex
+, uint16_t      *referencedNum
+)
+{
+  if (!Binary_isSetL2R( isReferenced_L2R, vertex ))
+  {
+    Binary_setL2R( isReferenced_L2R, vertex ) ;
+    ++*referencedNum ;
+  }
+}
+
+
+static
+DigitTemplates_Value*
+DigitTemplates_decode
+( const Digit2D_Type type )
+{
+  const DigitTemplate *template    = DIGIT_TEMPLATES + type ;
+  const uint16_t       edgesNum    = template->edgeInfo->edgesNum ;
+  const uint16_t       verticesNum = template->vertexInfo->pointsNum ;
+  const Edge          *edges       = template->edgeInfo->edges ;
+
+  // Sizing pass.
+  uint8_t   isReferenced_L2R[(256 + 7) >> 3] ;   // Edge vertex indexes are uint8_t.
+  uint16_t  activeEdgesNum    = 0 ;
+  uint16_t  activeVerticesNum = 0 ;
+
+  for ( uint8_t value = 0  ;  value < DIGIT2D_VALUES_NUM  ;  ++value )
+  {
+    memset( isReferenced_L2R, 0, sizeof(isReferenced_L2R) ) ;
+
+    for ( uint16_t e = 0  ;  e < edgesNum  ;  ++e )
+      if (Binary_isSetL2R( template->valueEdgeMap_L2R[value], e ))
+      {
+        ++activeEdgesNum ;
+        DigitTemplates_reference( isReferenced_L2R, edges[e].v1, &activeVerticesNum ) ;
+        DigitTemplates_reference( isReferenced_L2R, edges[e].v2, &activeVerticesNum ) ;
+      }
+  }
+
+  DigitTemplates_Value *values = malloc( DIGIT2D_VALUES_NUM * sizeof(DigitTemplates_Value)
+                                       + activeEdgesNum    * sizeof(uint16_t)
+                                       + activeVerticesNum * sizeof(uint8_t)
+                                       ) ;
+  if (values == NULL)
+  {
+    LOGE( "DigitTemplates_decode:: out of memory for type %d", type ) ;
+    return NULL ;
+  }
+
+  uint16_t *edgeNext   = (uint16_t *)(values + DIGIT2D_VALUES_NUM) ;
+  uint8_t  *vertexNext = (uint8_t *)(edgeNext + activeEdgesNum) ;
+
+  for ( uint8_t value = 0  ;  value < DIGIT2D_VALUES_NUM  ;  ++value )
+  {
+    DigitTemplates_Value *v = values + value ;
+    v->edges    = edgeNext ;
+    v->edgesNum = 0 ;
+    memset( isReferenced_L2R, 0, sizeof(isReferenced_L2R) ) ;
+
+    for ( uint16_t e = 0  ;  e < edgesNum  ;  ++e )
+      if (Binary_isSetL2R( template->valueEdgeMap_L2R[value], e ))
+      {
+        v->edges[v->edgesNum++] = e ;
+        Binary_setL2R( isReferenced_L2R, edges[e].v1 ) ;
+        Binary_setL2R( isReferenced_L2R, edges[e].v2 ) ;
+      }
+
+    edgeNext += v->edgesNum ;
+
+    v->vertices    = vertexNext ;
+    v->verticesNum = 0 ;
+
+    for ( uint16_t i = 0  ;  i < verticesNum  ;  ++i )
+      if (Binary_isSetL2R( isReferenced_L2R, i ))
+        v->vertices[v->verticesNum++] = i ;
+
+    vertexNext += v->verticesNum ;
+  }
+
+  LOGD( "DigitTemplates_decode:: type = %d, edges = %d, active edges (all values) = %d", type, edgesNum, activeEdgesNum ) ;
+
+  return values ;
+}
+
+
+const DigitTemplates_Value*
+DigitTemplates_value
+( const Digit2D_Type type
+, const int8_t       value
+)
+{
+  if (type >= DIGIT2D_TYPES_NUM  ||  value < 0  ||  value >= DIGIT2D_VALUES_NUM)
+    return NULL ;
+
+  if (s_values[type] == NULL)
+    s_values[type] = DigitTemplates_decode( type ) ;
+
+  return (s_values[type] != NULL) ? s_values[type] + value : NULL ;
+}
+
+
+uint16_t
+DigitTemplates_edgesMax
+( const Digit2D_Type type )
+{
+  if (type >= DIGIT2D_TYPES_NUM)
+    return 0 ;
+
+  const DigitTemplate *template = DIGIT_TEMPLATES + type ;
+  uint16_t             edgesMax = 0 ;
+
+  for ( uint8_t value = 0  ;  value < DIGIT2D_VALUES_NUM  ;  ++value )
+  {
+    uint16_t edgesNum = 0 ;
+
+    for ( uint16_t e = 0  ;  e < template->edgeInfo->edgesNum  ;  ++e )
+      edgesNum += Binary_isSetL2R( template->valueEdgeMap_L2R[value], e ) ;
+
+    if (edgesNum > edgesMax)
+      edgesMax = edgesNum ;
+  }
+
+  return edgesMax ;
+}
+
+
+void
+DigitTemplates_release
+( const Digit2D_Type type )
+{
+  if (type >= DIGIT2D_TYPES_NUM)
+    return ;
+
+  free( s_values[type] ) ;
+  s_values[type] = NULL ;
+}
+
+
+void
+DigitTemplates_finalize
+( )
+{
+  for ( uint8_t type = 0  ;  type < DIGIT2D_TYPES_NUM  ;  ++type )
+    DigitTemplates_release( type ) ;
+}
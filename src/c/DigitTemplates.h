@@ -0,0 +1,48 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DigitTemplates.h
+   Author   : agent
+
+   Last revision: 12h53 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/Digit2D.h>
+
+
+#define  DIGIT2D_TYPES_NUM   (DIGIT2D_CURVYBONESKIN + 1)
+#define  DIGIT2D_VALUES_NUM  10
+
+
+// Everything the package keeps per Digit2D_Type, in one table.
+typedef struct
+{ const I2_8_PathInfo  *vertexInfo ;
+  const EdgeInfo       *edgeInfo ;
+  const unsigned char **valueEdgeMap_L2R ;   // [DIGIT2D_VALUES_NUM]
+  const unsigned char **boneMask_L2R ;       // NULL for single stroke (pure bone or pure skin) types.
+} DigitTemplate ;
+
+extern const DigitTemplate  DIGIT_TEMPLATES[DIGIT2D_TYPES_NUM] ;
+
+
+// Value edge maps decoded: the edges lit by each value and the vertices they reference.
+typedef struct
+{ uint16_t   edgesNum ;
+  uint16_t  *edges ;          // Active edge indexes, ascending.
+  uint16_t   verticesNum ;
+  uint8_t   *vertices ;       // Vertex indexes referenced by the active edges, ascending.
+} DigitTemplates_Value ;
+
+
+// Decoded on first use of each type, kept until DigitTemplates_release( ) or DigitTemplates_finalize( ).
+// NULL if out of memory or value out of range.
+const DigitTemplates_Value*  DigitTemplates_value( const Digit2D_Type type, const int8_t value ) ;
+
+// Largest lit edge count over the values of a type, counted on the value edge maps (nothing is decoded).
+uint16_t  DigitTemplates_edgesMax( const Digit2D_Type type ) ;
+
+// Frees one decoded type (decoded again on next use).
+void  DigitTemplates_release ( const Digit2D_Type type ) ;
+void  DigitTemplates_finalize( ) ;
@@ -0,0 +1,186 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DisplayList.c
+   Author   : agent
+
+   Last revision: 12h53 October 18 2026
+*/
+
+#include <pebble.h>
+#include "DisplayList.h"
+#include "Config.h"
+
+
+#define  FNV_OFFSET  2166136261u
+#define  FNV_PRIME     16777619u
+
+static inline
+uint32_t
+DisplayList_hash
+( uint32_t       hash
+, const uint32_t value
+)
+{ return (hash ^ value) * FNV_PRIME ; }
+
+
+// Both (possibly negative) coordinates as one hash word.
+static inline
+uint32_t
+DisplayList_pack
+( const GPoint p )
+{ return (uint32_t)(uint16_t)p.x  |  (uint32_t)(uint16_t)p.y << 16 ; }
+
+
+DisplayList*
+DisplayList_new
+( const uint16_t segmentsMax
+, const uint16_t batchesMax
+)
+{
+  DisplayList *this = malloc( sizeof(DisplayList) ) ;
+
+  if (this == NULL)
+    return NULL ;
+
+  *this = (DisplayList){ .batchesMax  = batchesMax
+                       , .segmentsMax = segmentsMax
+                       , .batches     = malloc( batchesMax  * sizeof(DisplayList_Batch) )
+                       , .segments    = malloc( segmentsMax * sizeof(Draw2D_Segment)    )
+                       , .isChanged   = true
+                       } ;
+
+  if (this->batches == NULL  ||  this->segments == NULL)
+    return DisplayList_free( this ) ;
+
+  return this ;
+}
+
+
+DisplayList*
+DisplayList_free
+( DisplayList *this )
+{
+  if (this != NULL)
+  {
+    free( this->batches  ) ;
+    free( this->segments ) ;
+    free( this           ) ;
+  }
+
+  return NULL ;
+}
+
+
+void
+DisplayList_begin
+( DisplayList *this
+, const int    w
+, const int    h
+)
+{
+  this->screen      = GSize( w, h ) ;
+  this->batchesNum  = 0 ;
+  this->segmentsNum = 0 ;
+}
+
+
+void
+DisplayList_addBatch
+( DisplayList           *this
+, const Draw2D_Stroke   *stroke
+, const Draw2D_Stroke   *strokeAlternate
+, const Draw2D_Segment  *segments
+, uint16_t               segmentsNum
+)
+{
+  if (segmentsNum == 0)
+    return ;
+
+  if (this->batchesNum == this->batchesMax)
+  {
+    LOGW( "DisplayList_addBatch:: batches overflow, %d segments dropped", segmentsNum ) ;
+    return ;
+  }
+
+  if (this->segmentsNum + segmentsNum > this->segmentsMax)
+  {
+    LOGW( "DisplayList_addBatch:: segments overflow, %d segments dropped", this->segmentsNum + segmentsNum - this->segmentsMax ) ;
+    segmentsNum = this->segmentsMax - this->segmentsNum ;
+  }
+
+  if (segmentsNum == 0)
+    return ;
+
+  Draw2D_Segment    *dst   = this->segments + this->segmentsNum ;
+  DisplayList_Batch *batch = this->batches  + this->batchesNum++ ;
+
+  *batch = (DisplayList_Batch){ .stroke          = *stroke
+                              , .strokeAlternate = *strokeAlternate
+                              , .segmentsFirst   = this->segmentsNum
+                              , .segmentsNum     = segmentsNum
+                              } ;
+
+  uint32_t hash = FNV_OFFSET ;
+  hash = DisplayList_hash( hash, stroke->width          | stroke->color.argb          << 8 ) ;
+  hash = DisplayList_hash( hash, strokeAlternate->width | strokeAlternate->color.argb << 8 ) ;
+
+  for ( uint16_t i = 0  ;  i < segmentsNum  ;  ++i )
+  {
+    const Draw2D_Segment *segment = segments + i ;
+    dst[i] = *segment ;
+
+    hash = DisplayList_hash( hash, DisplayList_pack( segment->p0 ) ) ;
+    hash = DisplayList_hash( hash, DisplayList_pack( segment->p1 ) ) ;
+    hash = DisplayList_hash( hash, segment->ink  | segment->isAlternate << 8 ) ;
+  }
+
+  batch->hash = hash ;
+
+  this->segmentsNum += segmentsNum ;
+}
+
+
+void
+DisplayList_diff
+( DisplayList       *this
+, const DisplayList *previous
+)
+{
+  this->isChanged = this->batchesNum != previous->batchesNum  ||  !gsize_equal( &this->screen, &previous->screen ) ;
+
+  for ( uint16_t b = 0  ;  !this->isChanged  &&  b < this->batchesNum  ;  ++b )
+  {
+    const DisplayList_Batch *now = this->batches     + b ;
+    const DisplayList_Batch *was = previous->batches + b ;
+
+    this->isChanged = now->hash != was->hash  ||  now->segmentsNum != was->segmentsNum ;
+  }
+}
+
+
+void
+DisplayList_draw
+( GContext          *gCtx
+, const DisplayList *this
+, const int          w
+, const int          h
+)
+{
+  // Segments were projected centered on this->screen.
+  Draw2D_setOffset( GPoint( (w - this->screen.w) >> 1, (h - this->screen.h) >> 1 ) ) ;
+
+  for ( uint16_t b = 0  ;  b < this->batchesNum  ;  ++b )
+  {
+    const DisplayList_Batch *batch = this->batches + b ;
+
+    Draw2D_lines( gCtx
+                , this->segments + batch->segmentsFirst
+                , batch->segmentsNum
+                , &batch->stroke
+                , &batch->strokeAlternate
+                ) ;
+  }
+
+  Draw2D_setOffset( GPointZero ) ;
+}
+
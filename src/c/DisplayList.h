@@ -0,0 +1,59 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : DisplayList.h
+   Author   : agent
+
+   Last revision: 12h53 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include "Draw2D_Batch.h"
+
+
+// Per frame memory is bounded by the capacities given to DisplayList_new( ): segments beyond are dropped (and logged).
+
+
+typedef struct
+{ Draw2D_Stroke  stroke ;
+  Draw2D_Stroke  strokeAlternate ;
+  uint16_t       segmentsFirst ;     // Index of the batch first segment in DisplayList.segments.
+  uint16_t       segmentsNum ;
+  uint32_t       hash ;              // Of strokes & segments: used to diff consecutive frames.
+} DisplayList_Batch ;
+
+
+typedef struct
+{ GSize               screen ;              // Screen size the segments were projected for.
+  uint16_t            batchesMax ;
+  uint16_t            segmentsMax ;
+  uint16_t            batchesNum ;
+  DisplayList_Batch  *batches ;
+  uint16_t            segmentsNum ;
+  Draw2D_Segment     *segments ;            // Screen space int16 pairs + stroke state.
+  bool                isChanged ;           // Does this frame differ from the previous one ?
+} DisplayList ;
+
+
+// NULL if out of memory.
+DisplayList*  DisplayList_new ( const uint16_t segmentsMax, const uint16_t batchesMax ) ;
+DisplayList*  DisplayList_free( DisplayList *this ) ;
+
+// Starts a new frame, to be projected for a w x h screen.
+void  DisplayList_begin( DisplayList *this, const int w, const int h ) ;
+
+void
+DisplayList_addBatch
+( DisplayList           *this
+, const Draw2D_Stroke   *stroke
+, const Draw2D_Stroke   *strokeAlternate
+, const Draw2D_Segment  *segments
+, uint16_t               segmentsNum
+) ;
+
+// Diffs this frame against the previous one (sets isChanged).
+void  DisplayList_diff( DisplayList *this, const DisplayList *previous ) ;
+
+// Replays the list: one Draw2D_lines( ) call per batch. Re-centered (no re-projection) if the screen size changed since.
+void  DisplayList_draw( GContext *gCtx, const DisplayList *this, const int w, const int h ) ;
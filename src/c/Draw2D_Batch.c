@@ -0,0 +1,364 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Draw2D_Batch.c
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#include <pebble.h>
+#include "Draw2D_Batch.h"
+#include "Config.h"
+
+
+// Pixel stride of each ink pattern: INK50 lights 1 of every 2 pixels, INK33 1 of every 3, ...
+static const uint8_t  s_inkStride[] = { [INK0]   = 0
+                                      , [INK100] = 1
+                                      , [INK50]  = 2
+                                      , [INK33]  = 3
+                                      , [INK25]  = 4
+                                      , [INK20]  = 5
+                                      } ;
+
+// Same patterns as precomputed masks: bit n lit <=> pixel n of the line is lit.
+// 60 = lcm(2,3,4,5) so every pattern repeats exactly within the mask.
+#define  INK_MASK_PERIOD  60
+
+static const uint64_t s_inkMask[] = { [INK0]   = 0x000000000000000ULL
+                                    , [INK100] = 0xFFFFFFFFFFFFFFFULL
+                                    , [INK50]  = 0x555555555555555ULL
+                                    , [INK33]  = 0x249249249249249ULL
+                                    , [INK25]  = 0x111111111111111ULL
+                                    , [INK20]  = 0x084210842108421ULL
+                                    } ;
+
+
+#if defined(PBL_BW) || defined(QEMU)
+static Draw2D_Backend  s_backend = DRAW2D_BACKEND_FRAMEBUFFER ;   // No antialiasing to lose.
+#else
+static Draw2D_Backend  s_backend = DRAW2D_BACKEND_GCONTEXT ;
+#endif
+
+
+static GPoint  s_offset = { 0, 0 } ;
+
+
+void
+Draw2D_setOffset
+( const GPoint offset )
+{ s_offset = offset ; }
+
+
+void
+Draw2D_setBackend
+( const Draw2D_Backend backend )
+{ s_backend = backend ; }
+
+
+Draw2D_Backend
+Draw2D_getBackend
+( )
+{ return s_backend ; }
+
+
+// FRAME BUFFER BACKEND
+
+static GBitmap  *s_fb = NULL ;          // Non NULL only between Draw2D_beginFrame( ) & Draw2D_endFrame( ).
+static int16_t   s_fb_w, s_fb_h ;
+
+#if defined(PBL_BW)
+// diorite/aplite: 1 bit per pixel, LSB is the leftmost pixel of each byte.
+static uint8_t  *s_fb_data ;
+static uint16_t  s_fb_bytesPerRow ;
+static bool      s_fb_inkIsWhite ;
+#elif defined(PBL_ROUND)
+// chalk: 8 bit per pixel, circular layout, each row only spans [min_x, max_x].
+#define  DRAW2D_FB_ROWS_MAX  180
+
+typedef struct
+{ uint8_t  *data ;
+  int16_t   min_x ;
+  int16_t   max_x ;
+} Draw2D_Row ;
+
+static Draw2D_Row  s_fb_row[DRAW2D_FB_ROWS_MAX] ;
+static uint8_t     s_fb_ink ;
+#else
+// basalt: 8 bit per pixel, rectangular layout.
+static uint8_t  *s_fb_data ;
+static uint16_t  s_fb_bytesPerRow ;
+static uint8_t   s_fb_ink ;
+#endif
+
+
+static inline
+void
+Draw2D_fbPlot
+( const int x
+, const int y
+)
+{
+  if (x < 0  ||  y < 0  ||  x >= s_fb_w  ||  y >= s_fb_h)
+    return ;
+
+#if defined(PBL_BW)
+  uint8_t *byte = s_fb_data + y * s_fb_bytesPerRow + (x >> 3) ;
+
+  if (s_fb_inkIsWhite)
+    *byte |=  (1 << (x & 7)) ;
+  else
+    *byte &= ~(1 << (x & 7)) ;
+#elif defined(PBL_ROUND)
+  const Draw2D_Row *row = s_fb_row + y ;
+
+  if (x >= row->min_x  &&  x <= row->max_x)
+    row->data[x] = s_fb_ink ;
+#else
+  s_fb_data[y * s_fb_bytesPerRow + x] = s_fb_ink ;
+#endif
+}
+
+
+// Horizontal run [x0, x1] of row y.
+static inline
+void
+Draw2D_fbSpanH
+( int        x0
+, int        x1
+, const int  y
+)
+{
+  if (y < 0  ||  y >= s_fb_h)
+    return ;
+
+#if defined(PBL_ROUND)
+  if (x0 < s_fb_row[y].min_x)  x0 = s_fb_row[y].min_x ;
+  if (x1 > s_fb_row[y].max_x)  x1 = s_fb_row[y].max_x ;
+  if (x0 <= x1)
+    memset( s_fb_row[y].data + x0, s_fb_ink, x1 - x0 + 1 ) ;
+#elif defined(PBL_BW)
+  if (x0 < 0)        x0 = 0 ;
+  if (x1 >= s_fb_w)  x1 = s_fb_w - 1 ;
+  for ( int x = x0  ;  x <= x1  ;  ++x )
+    Draw2D_fbPlot( x, y ) ;
+#else
+  if (x0 < 0)        x0 = 0 ;
+  if (x1 >= s_fb_w)  x1 = s_fb_w - 1 ;
+  if (x0 <= x1)
+    memset( s_fb_data + y * s_fb_bytesPerRow + x0, s_fb_ink, x1 - x0 + 1 ) ;
+#endif
+}
+
+
+// Vertical run [y0, y1] of column x.
+static inline
+void
+Draw2D_fbSpanV
+( const int  x
+, const int  y0
+, const int  y1
+)
+{
+  for ( int y = y0  ;  y <= y1  ;  ++y )
+    Draw2D_fbPlot( x, y ) ;
+}
+
+
+static
+void
+Draw2D_fbSetInk
+( const GColor color )
+{
+#if defined(PBL_BW)
+  s_fb_inkIsWhite = !gcolor_equal( color, GColorBlack ) ;
+#else
+  s_fb_ink = color.argb ;
+#endif
+}
+
+
+// Integer Bresenham. Thick lines are drawn as spans across the minor axis, one per major axis step.
+static
+void
+Draw2D_fbLine
+( const GPoint    p0
+, const GPoint    p1
+, const uint8_t   width
+, const uint64_t  inkMask
+)
+{
+  int x = p0.x, y = p0.y ;
+  const int dx =  abs( p1.x - x ), sx = (x < p1.x) ? 1 : -1 ;
+  const int dy = -abs( p1.y - y ), sy = (y < p1.y) ? 1 : -1 ;
+  const bool isXMajor = dx >= -dy ;
+  const int  lo = (width - 1) >> 1 ;
+  const int  hi =  width      >> 1 ;
+  int err = dx + dy ;
+
+  for ( uint8_t phase = 0  ;  ;  )
+  {
+    if ((inkMask >> phase) & 1)
+    {
+      if (width <= 1)
+        Draw2D_fbPlot( x, y ) ;
+      else if (isXMajor)
+        Draw2D_fbSpanV( x, y - lo, y + hi ) ;
+      else
+        Draw2D_fbSpanH( x - lo, x + hi, y ) ;
+    }
+
+    if (++phase == INK_MASK_PERIOD)
+      phase = 0 ;
+
+    if (x == p1.x  &&  y == p1.y)
+      break ;
+
+    const int e2 = err << 1 ;
+    if (e2 >= dy) { err += dy ; x += sx ; }
+    if (e2 <= dx) { err += dx ; y += sy ; }
+  }
+}
+
+
+void
+Draw2D_beginFrame
+( GContext *gCtx )
+{
+  if (s_backend != DRAW2D_BACKEND_FRAMEBUFFER  ||  s_fb != NULL)
+    return ;
+
+  if ((s_fb = graphics_capture_frame_buffer( gCtx )) == NULL)
+  {
+    LOGW( "Draw2D_beginFrame:: frame buffer capture failed, falling back to GContext." ) ;
+    return ;
+  }
+
+  const GRect bounds = gbitmap_get_bounds( s_fb ) ;
+  s_fb_w = bounds.size.w ;
+  s_fb_h = bounds.size.h ;
+
+#if defined(PBL_ROUND)
+  if (s_fb_h > DRAW2D_FB_ROWS_MAX)
+    s_fb_h = DRAW2D_FB_ROWS_MAX ;
+
+  for ( int16_t y = 0  ;  y < s_fb_h  ;  ++y )
+  {
+    const GBitmapDataRowInfo info = gbitmap_get_data_row_info( s_fb, y ) ;
+    s_fb_row[y] = (Draw2D_Row){ .data = info.data, .min_x = info.min_x, .max_x = info.max_x } ;
+  }
+#else
+  s_fb_data        = gbitmap_get_data( s_fb ) ;
+  s_fb_bytesPerRow = gbitmap_get_bytes_per_row( s_fb ) ;
+#endif
+}
+
+
+void
+Draw2D_endFrame
+( GContext *gCtx )
+{
+  if (s_fb == NULL)
+    return ;
+
+  graphics_release_frame_buffer( gCtx, s_fb ) ;
+  s_fb = NULL ;
+}
+
+
+// GCONTEXT BACKEND
+
+static
+void
+Draw2D_ditheredLine
+( GContext      *gCtx
+, const GPoint   p0
+, const GPoint   p1
+, const uint8_t  stride
+)
+{
+  int x = p0.x, y = p0.y ;
+  const int dx =  abs( p1.x - x ), sx = (x < p1.x) ? 1 : -1 ;
+  const int dy = -abs( p1.y - y ), sy = (y < p1.y) ? 1 : -1 ;
+  int err = dx + dy ;
+
+  for ( uint8_t phase = 0  ;  ;  )
+  {
+    if (phase == 0)
+      graphics_draw_pixel( gCtx, GPoint( x, y ) ) ;
+
+    if (++phase == stride)
+      phase = 0 ;
+
+    if (x == p1.x  &&  y == p1.y)
+      break ;
+
+    const int e2 = err << 1 ;
+    if (e2 >= dy) { err += dy ; x += sx ; }
+    if (e2 <= dx) { err += dx ; y += sy ; }
+  }
+}
+
+
+static
+void
+Draw2D_linesPass
+( GContext             *gCtx
+, const Draw2D_Segment *segments
+, const uint16_t        segmentsNum
+, const Draw2D_Stroke  *stroke
+, const bool            isAlternate
+)
+{
+  bool isConfigured = false ;
+
+  for ( uint16_t i = 0  ;  i < segmentsNum  ;  ++i )
+  {
+    const Draw2D_Segment *segment = segments + i ;
+
+    if (segment->isAlternate != isAlternate  ||  segment->ink == INK0)
+      continue ;
+
+    // Lazy: only switch stroke state if it is actually used.
+    if (!isConfigured)
+    {
+      if (s_fb != NULL)
+        Draw2D_fbSetInk( stroke->color ) ;
+      else
+      {
+        graphics_context_set_stroke_color( gCtx, stroke->color ) ;
+        graphics_context_set_stroke_width( gCtx, stroke->width ) ;
+      }
+
+      isConfigured = true ;
+    }
+
+    const GPoint p0 = GPoint( segment->p0.x + s_offset.x, segment->p0.y + s_offset.y ) ;
+    const GPoint p1 = GPoint( segment->p1.x + s_offset.x, segment->p1.y + s_offset.y ) ;
+
+    if (s_fb != NULL)
+      Draw2D_fbLine( p0, p1, stroke->width, s_inkMask[segment->ink] ) ;
+    else if (segment->ink == INK100)
+      graphics_draw_line( gCtx, p0, p1 ) ;
+    else
+      Draw2D_ditheredLine( gCtx, p0, p1, s_inkStride[segment->ink] ) ;
+  }
+}
+
+
+void
+Draw2D_lines
+( GContext             *gCtx
+, const Draw2D_Segment *segments
+, const uint16_t        segmentsNum
+, const Draw2D_Stroke  *stroke
+, const Draw2D_Stroke  *strokeAlternate
+)
+{
+  if (segments == NULL  ||  segmentsNum == 0)
+    return ;
+
+  Draw2D_linesPass( gCtx, segments, segmentsNum, stroke, false ) ;
+
+  if (strokeAlternate != NULL)
+    Draw2D_linesPass( gCtx, segments, segmentsNum, strokeAlternate, true ) ;
+}
@@ -0,0 +1,58 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Draw2D_Batch.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/Draw2D.h>
+
+
+typedef struct
+{ GPoint   p0 ;
+  GPoint   p1 ;
+  uint8_t  ink         :3 ;   // INK0 .. INK20
+  uint8_t  isAlternate :1 ;   // Use the alternate stroke (width & color).
+} Draw2D_Segment ;
+
+
+typedef struct
+{ uint8_t  width ;
+  GColor   color ;
+} Draw2D_Stroke ;
+
+
+typedef enum { DRAW2D_BACKEND_GCONTEXT       // graphics_draw_line( ): antialiasing aware.
+             , DRAW2D_BACKEND_FRAMEBUFFER    // Bresenham/span writer straight into the captured frame buffer: no antialiasing.
+             }
+Draw2D_Backend ;
+
+
+void            Draw2D_setBackend( const Draw2D_Backend backend ) ;
+Draw2D_Backend  Draw2D_getBackend( ) ;
+
+// Translation applied to all segments drawn by Draw2D_lines( ).
+void  Draw2D_setOffset( const GPoint offset ) ;
+
+// Brackets all Draw2D_lines( ) calls of a frame. Under DRAW2D_BACKEND_FRAMEBUFFER the frame buffer is
+// captured once at Draw2D_beginFrame( ) and released at Draw2D_endFrame( ): no GContext drawing in between.
+void  Draw2D_beginFrame( GContext *gCtx ) ;
+void  Draw2D_endFrame  ( GContext *gCtx ) ;
+
+
+// Draws all segments grouped by stroke state: the GContext is reconfigured at most twice per call
+// (once for the segments using stroke, once for the ones using strokeAlternate).
+// INK50/INK33/INK25/INK20 dithered segments are rasterized inside the batch.
+
+void
+Draw2D_lines
+( GContext             *gCtx
+, const Draw2D_Segment *segments
+, const uint16_t        segmentsNum
+, const Draw2D_Stroke  *stroke
+, const Draw2D_Stroke  *strokeAlternate
+) ;
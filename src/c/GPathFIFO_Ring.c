@@ -0,0 +1,205 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : GPathFIFO_Ring.c
+   Author   : agent
+
+   Last revision: 13h01 October 18 2026
+*/
+
+#include <pebble.h>
+#include "GPathFIFO_Ring.h"
+#include "TimeMs.h"
+#include "Config.h"
+
+
+// Not in the watchface: no caller yet, only BENCHMARK builds measure it against the package GPathFIFO.
+#ifdef BENCHMARK
+
+GPathFIFO_Ring*
+GPathFIFO_Ring_new
+( const uint16_t maxPoints )
+{
+  if (maxPoints == 0  ||  maxPoints > 0x8000)
+    return NULL ;
+
+  uint16_t capacity = 1 ;
+
+  while (capacity < maxPoints)
+    capacity <<= 1 ;
+
+  GPathFIFO_Ring *this = malloc( sizeof(GPathFIFO_Ring) ) ;
+
+  if (this == NULL)
+    return NULL ;
+
+  if ((this->points = malloc( capacity * sizeof(GPoint) )) == NULL)
+  {
+    free( this ) ;
+    return NULL ;
+  }
+
+  this->maxPoints = maxPoints ;
+  this->mask      = capacity - 1 ;
+  GPathFIFO_Ring_init( this ) ;
+
+  return this ;
+}
+
+
+GPathFIFO_Ring*
+GPathFIFO_Ring_free
+( GPathFIFO_Ring *this )
+{
+  if (this == NULL)
+    return NULL ;
+
+  free( this->points ) ;
+  this->points = NULL ;
+
+  return this ;
+}
+
+
+void
+GPathFIFO_Ring_init
+( GPathFIFO_Ring *this )
+{
+  this->head      = 0 ;
+  this->pointsNum = 0 ;
+}
+
+
+void
+GPathFIFO_Ring_push
+( GPathFIFO_Ring *this
+, const GPoint    point
+)
+{
+  this->points[this->head++ & this->mask] = point ;
+
+  if (this->pointsNum < this->maxPoints)
+    ++this->pointsNum ;
+}
+
+
+uint8_t
+GPathFIFO_Ring_segments
+( const GPathFIFO_Ring *this
+, GPathFIFO_Segment     segments[2]
+)
+{
+  if (this->pointsNum == 0)
+    return 0 ;
+
+  const uint16_t oldest = (uint16_t)(this->head - this->pointsNum) & this->mask ;
+  const uint16_t tail   = this->mask + 1 - oldest ;      // Room from the oldest point to the ring end.
+
+  if (this->pointsNum <= tail)
+  {
+    segments[0] = (GPathFIFO_Segment){ .points = this->points + oldest, .pointsNum = this->pointsNum } ;
+    return 1 ;
+  }
+
+  segments[0] = (GPathFIFO_Segment){ .points = this->points + oldest, .pointsNum = tail } ;
+  segments[1] = (GPathFIFO_Segment){ .points = this->points, .pointsNum = this->pointsNum - tail } ;
+  return 2 ;
+}
+
+
+void
+GPathFIFO_Ring_drawOutlineOpen
+( const GPathFIFO_Ring *this
+, GContext             *gCtx
+)
+{
+  GPathFIFO_Segment segments[2] ;
+  const uint8_t     segmentsNum = GPathFIFO_Ring_segments( this, segments ) ;
+
+  for ( uint8_t s = 0  ;  s < segmentsNum  ;  ++s )
+  {
+    GPath path = { .num_points = segments[s].pointsNum, .points = segments[s].points } ;
+
+    if (path.num_points > 1)
+      gpath_draw_outline_open( gCtx, &path ) ;
+  }
+
+  // The stroke across the ring end.
+  if (segmentsNum == 2)
+    graphics_draw_line( gCtx, segments[0].points[segments[0].pointsNum - 1], segments[1].points[0] ) ;
+}
+
+
+// The flat FIFO as the package does it: shift everything down once full.
+static
+void
+GPathFIFO_Ring_flatPush
+( GPath          *path
+, const uint16_t  maxPoints
+, const GPoint    point
+)
+{
+  if (path->num_points < maxPoints)
+    path->points[path->num_points++] = point ;
+  else
+  {
+    memmove( path->points, path->points + 1, (maxPoints - 1) * sizeof(GPoint) ) ;
+    path->points[maxPoints - 1] = point ;
+  }
+}
+
+
+void
+GPathFIFO_Ring_benchmark
+( )
+{
+  static const uint16_t  sizes[] = { 16, 64, 144, 256 } ;   // Short trail .. screen wide plot.
+  const uint16_t         pushesNum = 4096 ;
+
+  for ( uint8_t i = 0  ;  i < ARRAY_LENGTH(sizes)  ;  ++i )
+  {
+    const uint16_t  maxPoints = sizes[i] ;
+    GPathFIFO_Ring *ring      = GPathFIFO_Ring_new( maxPoints ) ;
+    GPath           flat      = { .num_points = 0, .points = malloc( maxPoints * sizeof(GPoint) ) } ;
+
+    if (ring == NULL  ||  flat.points == NULL)
+    {
+      free( GPathFIFO_Ring_free( ring ) ) ;
+      free( flat.points ) ;
+      LOGW( "GPathFIFO_Ring_benchmark:: no heap for %d points", maxPoints ) ;
+      return ;
+    }
+
+    uint32_t start_ms = TimeMs_now( ) ;
+
+    for ( uint16_t p = 0  ;  p < pushesNum  ;  ++p )
+      GPathFIFO_Ring_flatPush( &flat, maxPoints, GPoint( p, p >> 1 ) ) ;
+
+    const uint32_t flat_ms = TimeMs_now( ) - start_ms ;
+    start_ms = TimeMs_now( ) ;
+
+    for ( uint16_t p = 0  ;  p < pushesNum  ;  ++p )
+      GPathFIFO_Ring_push( ring, GPoint( p, p >> 1 ) ) ;
+
+    const uint32_t ring_ms = TimeMs_now( ) - start_ms ;
+
+    // Same points in the same order, else the ring is broken.
+    GPathFIFO_Segment segments[2] ;
+    const uint8_t     segmentsNum = GPathFIFO_Ring_segments( ring, segments ) ;
+    bool              isSame      = true ;
+    uint16_t          f           = 0 ;
+
+    for ( uint8_t s = 0  ;  s < segmentsNum  ;  ++s )
+      for ( uint16_t p = 0  ;  p < segments[s].pointsNum  ;  ++p, ++f )
+        isSame = isSame  &&  gpoint_equal( &segments[s].points[p], &flat.points[f] ) ;
+
+    LOGI( "GPathFIFO_Ring_benchmark:: %d points, %d pushes: flat %d ms, ring %d ms, %d segments%s"
+        , maxPoints, pushesNum, (int)flat_ms, (int)ring_ms, segmentsNum
+        , (isSame  &&  f == flat.num_points) ? "" : " MISMATCH"
+        ) ;
+
+    free( GPathFIFO_Ring_free( ring ) ) ;
+    free( flat.points ) ;
+  }
+}
+
+#endif
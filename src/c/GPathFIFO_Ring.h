@@ -0,0 +1,50 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : GPathFIFO_Ring.h
+   Author   : agent
+
+   Last revision: 13h01 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include "Config.h"
+
+
+#ifdef BENCHMARK
+
+// Trailing path (motion trails, sensor plots) on a power of two ring: O(1) push, the points are never moved.
+// Drop-in for the package GPathFIFO, whose flat GPath has to shift every point on each push once full.
+// The oldest to newest points are seen as at most two contiguous segments.
+
+typedef struct
+{ uint16_t  maxPoints ;      // Points kept (the newest).
+  uint16_t  mask ;           // Ring capacity - 1, capacity being maxPoints rounded up to a power of two.
+  uint16_t  head ;           // Free running: next point goes to points[head & mask].
+  uint16_t  pointsNum ;      // Points held, up to maxPoints.
+  GPoint   *points ;
+} GPathFIFO_Ring ;
+
+
+typedef struct
+{ GPoint   *points ;
+  uint16_t  pointsNum ;
+} GPathFIFO_Segment ;
+
+
+GPathFIFO_Ring*  GPathFIFO_Ring_new ( const uint16_t maxPoints ) ;
+GPathFIFO_Ring*  GPathFIFO_Ring_free( GPathFIFO_Ring *this ) ;
+void             GPathFIFO_Ring_init( GPathFIFO_Ring *this ) ;      // Empties it.
+void             GPathFIFO_Ring_push( GPathFIFO_Ring *this, const GPoint point ) ;
+
+// Oldest first into segments[0..1], returns how many (0, 1 or 2). They point into the ring: valid until the next push.
+uint8_t  GPathFIFO_Ring_segments( const GPathFIFO_Ring *this, GPathFIFO_Segment segments[2] ) ;
+
+// Open outline through all the points, oldest to newest.
+void  GPathFIFO_Ring_drawOutlineOpen( const GPathFIFO_Ring *this, GContext *gCtx ) ;
+
+// Push cost against the flat shifting FIFO, at trail & plot sizes.
+void  GPathFIFO_Ring_benchmark( ) ;
+
+#endif
@@ -0,0 +1,168 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Kernel3D.h
+   Author   : agent
+
+   Last revision: 12h59 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/Draw2D.h>
+#include <karambola/R3.h>
+
+
+// Mesh/camera hot loops, inlined into their callers.
+
+// Vertex arrays are walked by byte stride, so that any vertex struct embedding an R3 can be used as is.
+#define  KERNEL3D_AT(ptr,type,i,stride)   ((const type *)((const uint8_t *)(ptr) + (i) * (stride)))
+
+
+static inline
+float
+Kernel3D_dot
+( const R3 *a
+, const R3 *b
+)
+{ return a->x * b->x  +  a->y * b->y  +  a->z * b->z ; }
+
+
+// Affine row . point: row[0..2] . p + row[3]
+static inline
+float
+Kernel3D_row
+( const float  row[4]
+, const R3    *p
+)
+{ return row[0] * p->x  +  row[1] * p->y  +  row[2] * p->z  +  row[3] ; }
+
+
+// Is the (outer side of) the plane defined by point & normal visible from viewPoint ?
+static inline
+bool
+Kernel3D_isFacing
+( const R3 *normal
+, const R3 *point
+, const R3 *viewPoint
+)
+{
+  const R3 toViewPoint = { .x = viewPoint->x - point->x
+                         , .y = viewPoint->y - point->y
+                         , .z = viewPoint->z - point->z
+                         } ;
+
+  return Kernel3D_dot( &toViewPoint, normal ) > 0.0f ;
+}
+
+
+// screen = center + (X . p, Y . p) / (Z . p), for the points whose state is not hidden.
+static inline
+void
+Kernel3D_projectPerspective
+( const float       X[4]
+, const float       Y[4]
+, const float       Z[4]
+, const int16_t     centerX
+, const int16_t     centerY
+, const R3         *point
+, const ViewFlags  *state
+, const size_t      stride
+, const uint16_t    pointsNum
+, GPoint           *screenPoints
+)
+{
+  for ( uint16_t i = 0  ;  i < pointsNum  ;  ++i )
+  {
+    if (KERNEL3D_AT( state, ViewFlags, i, stride )->isHidden)
+      continue ;
+
+    const R3    *p    = KERNEL3D_AT( point, R3, i, stride ) ;
+    const float  invZ = 1.0f / Kernel3D_row( Z, p ) ;
+
+    screenPoints[i] = GPoint( centerX + (int)(invZ * Kernel3D_row( X, p ))
+                            , centerY + (int)(invZ * Kernel3D_row( Y, p ))
+                            ) ;
+  }
+}
+
+
+// screen = center + (X . p, Y . p), for the points whose state is not hidden.
+static inline
+void
+Kernel3D_projectIsometric
+( const float       X[4]
+, const float       Y[4]
+, const int16_t     centerX
+, const int16_t     centerY
+, const R3         *point
+, const ViewFlags  *state
+, const size_t      stride
+, const uint16_t    pointsNum
+, GPoint           *screenPoints
+)
+{
+  for ( uint16_t i = 0  ;  i < pointsNum  ;  ++i )
+  {
+    if (KERNEL3D_AT( state, ViewFlags, i, stride )->isHidden)
+      continue ;
+
+    const R3 *p = KERNEL3D_AT( point, R3, i, stride ) ;
+
+    screenPoints[i] = GPoint( centerX + (int)Kernel3D_row( X, p )
+                            , centerY + (int)Kernel3D_row( Y, p )
+                            ) ;
+  }
+}
+
+
+// Grows the min/max box to include p.
+static inline
+void
+Kernel3D_boundsAdd
+( const R3 *p
+, R3       *min
+, R3       *max
+)
+{
+  if (p->x < min->x) min->x = p->x ; else if (p->x > max->x) max->x = p->x ;
+  if (p->y < min->y) min->y = p->y ; else if (p->y > max->y) max->y = p->y ;
+  if (p->z < min->z) min->z = p->z ; else if (p->z > max->z) max->z = p->z ;
+}
+
+
+// Axis aligned bounding box of pointsNum points.
+static inline
+void
+Kernel3D_bounds
+( const R3        *point
+, const size_t     stride
+, const uint16_t   pointsNum
+, R3              *min
+, R3              *max
+)
+{
+  *min = *max = *point ;
+
+  for ( uint16_t i = 1  ;  i < pointsNum  ;  ++i )
+    Kernel3D_boundsAdd( KERNEL3D_AT( point, R3, i, stride ), min, max ) ;
+}
+
+
+// Same, over the indexesNum points point[indexes[0..]] only.
+static inline
+void
+Kernel3D_boundsIndexed
+( const R3        *point
+, const size_t     stride
+, const uint8_t   *indexes
+, const uint16_t   indexesNum
+, R3              *min
+, R3              *max
+)
+{
+  *min = *max = *KERNEL3D_AT( point, R3, indexes[0], stride ) ;
+
+  for ( uint16_t i = 1  ;  i < indexesNum  ;  ++i )
+    Kernel3D_boundsAdd( KERNEL3D_AT( point, R3, indexes[i], stride ), min, max ) ;
+}
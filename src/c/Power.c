@@ -0,0 +1,169 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Power.c
+   Author   : agent
+
+   Last revision: 12h52 October 18 2026
+*/
+
+#include <pebble.h>
+#include "Power.h"
+#include "main.h"
+#include "Wakeups.h"
+#include "Config.h"
+
+
+static const PowerPolicy  s_policy[POWER_TIERS_NUM]
+= { [POWER_TIER_CHARGING] = { .frameInterval_ms        = ANIMATION_INTERVAL_MS
+                            , .isTapLaunchAllowed      = true
+                            , .accelPeekEvery          = 1
+                            , .steadyTickUnit          = SECOND_UNIT
+                            , .second100thsInterval_ms = 0
+                            , .steadyFlipStepsPerFrame = 1
+                            }
+  , [POWER_TIER_NORMAL]   = { .frameInterval_ms        = ANIMATION_INTERVAL_MS
+                            , .isTapLaunchAllowed      = true
+                            , .accelPeekEvery          = 1
+                            , .steadyTickUnit          = MINUTE_UNIT
+                            , .second100thsInterval_ms = 0
+                            , .steadyFlipStepsPerFrame = 2
+                            }
+  , [POWER_TIER_SAVER]    = { .frameInterval_ms        = 2 * ANIMATION_INTERVAL_MS
+                            , .isTapLaunchAllowed      = true
+                            , .accelPeekEvery          = 2
+                            , .steadyTickUnit          = MINUTE_UNIT
+                            , .second100thsInterval_ms = 100
+                            , .steadyFlipStepsPerFrame = 3
+                            }
+  , [POWER_TIER_CRITICAL] = { .frameInterval_ms        = 3 * ANIMATION_INTERVAL_MS
+                            , .isTapLaunchAllowed      = false
+                            , .accelPeekEvery          = 4
+                            , .steadyTickUnit          = MINUTE_UNIT
+                            , .second100thsInterval_ms = 250
+                            , .steadyFlipStepsPerFrame = 5
+                            }
+  } ;
+
+
+// Measured per tier since Power_initialize( ), logged on each tier change and at exit: how long the watch stayed
+// in it and how much charge it used there. Pebble reports the charge in 10% steps: drain rates take hours to read.
+typedef struct
+{ uint32_t  seconds[POWER_TIERS_NUM] ;
+  uint8_t   percentDrained[POWER_TIERS_NUM] ;
+} Power_Stats ;
+
+
+static PowerTier               s_tier     = POWER_TIER_NORMAL ;
+static PowerTierChangeHandler  s_onChange = NULL ;
+
+static Power_Stats             s_stats ;
+static time_t                  s_tierSince ;      // Start of the time not yet accounted to s_tier.
+static uint8_t                 s_lastPercent ;
+
+
+static
+PowerTier
+Power_tierOf
+( const BatteryChargeState charge )
+{
+  if (charge.is_plugged)
+    return POWER_TIER_CHARGING ;
+
+  if (charge.charge_percent <= POWER_CRITICAL_PERCENT)
+    return POWER_TIER_CRITICAL ;
+
+  if (charge.charge_percent <= POWER_SAVER_PERCENT)
+    return POWER_TIER_SAVER ;
+
+  return POWER_TIER_NORMAL ;
+}
+
+
+// Accounts the time since the last call, and the charge used since then, to the current tier.
+static
+void
+Power_account
+( const BatteryChargeState charge )
+{
+  const time_t now = time( NULL ) ;
+
+  s_stats.seconds[s_tier] += (uint32_t)(now - s_tierSince) ;
+  s_tierSince              = now ;
+
+  if (!charge.is_plugged  &&  charge.charge_percent < s_lastPercent)
+    s_stats.percentDrained[s_tier] += s_lastPercent - charge.charge_percent ;
+
+  s_lastPercent = charge.charge_percent ;
+}
+
+
+static
+void
+Power_log
+( )
+{
+  for ( uint8_t tier = 0  ;  tier < POWER_TIERS_NUM  ;  ++tier )
+    LOGI( "Power_log:: tier %d: %d s, %d%% drained", tier, (int)s_stats.seconds[tier], s_stats.percentDrained[tier] ) ;
+}
+
+
+static
+void
+battery_state_service_handler
+( BatteryChargeState charge )
+{
+  Wakeups_count( WAKEUP_SENSOR ) ;
+
+  const PowerTier tier = Power_tierOf( charge ) ;
+
+  Power_account( charge ) ;
+
+  if (tier == s_tier)
+    return ;
+
+  LOGI( "battery_state_service_handler:: charge = %d%%, tier %d -> %d", charge.charge_percent, s_tier, tier ) ;
+  Power_log( ) ;
+  s_tier = tier ;
+
+  if (s_onChange != NULL)
+    s_onChange( tier ) ;
+}
+
+
+void
+Power_initialize
+( PowerTierChangeHandler onChange )
+{
+  const BatteryChargeState charge = battery_state_service_peek( ) ;
+
+  s_tier        = Power_tierOf( charge ) ;
+  s_onChange    = onChange ;
+  s_stats       = (Power_Stats){ 0 } ;
+  s_tierSince   = time( NULL ) ;
+  s_lastPercent = charge.charge_percent ;
+  battery_state_service_subscribe( battery_state_service_handler ) ;
+}
+
+
+void
+Power_finalize
+( )
+{
+  battery_state_service_unsubscribe( ) ;
+  Power_account( battery_state_service_peek( ) ) ;
+  Power_log( ) ;
+  s_onChange = NULL ;
+}
+
+
+PowerTier
+Power_getTier
+( )
+{ return s_tier ; }
+
+
+const PowerPolicy*
+Power_getPolicy
+( )
+{ return &s_policy[s_tier] ; }
+
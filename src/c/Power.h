@@ -0,0 +1,44 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Power.h
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+typedef enum { POWER_TIER_CHARGING        // Plugged in: spend freely.
+             , POWER_TIER_NORMAL
+             , POWER_TIER_SAVER           // charge <= POWER_SAVER_PERCENT
+             , POWER_TIER_CRITICAL        // charge <= POWER_CRITICAL_PERCENT
+             , POWER_TIERS_NUM
+             }
+PowerTier ;
+
+#define  POWER_SAVER_PERCENT     30
+#define  POWER_CRITICAL_PERCENT  10
+
+
+typedef struct
+{ uint16_t   frameInterval_ms ;          // Animation frame interval (LAUNCH, DYNAMIC, PARK & digit flips).
+  bool       isTapLaunchAllowed ;        // May a tap start LAUNCH (and then DYNAMIC) from STEADY.
+  uint8_t    accelPeekEvery ;            // Accelerometer is peeked once every accelPeekEvery frames.
+  TimeUnits  steadyTickUnit ;            // tick_timer_service resolution while in STEADY mode.
+  uint16_t   second100thsInterval_ms ;   // Minimum interval between 100ths face updates (0: on every frame).
+  uint8_t    steadyFlipStepsPerFrame ;   // STEADY digit flips cover this many nominal steps per frame (coarser flip table).
+} PowerPolicy ;
+
+
+typedef void (*PowerTierChangeHandler)( const PowerTier tier ) ;
+
+
+// Subscribes to battery_state_service. onChange is called whenever the tier changes.
+void  Power_initialize( PowerTierChangeHandler onChange ) ;
+void  Power_finalize  ( ) ;
+
+PowerTier           Power_getTier( ) ;
+const PowerPolicy*  Power_getPolicy( ) ;
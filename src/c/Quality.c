@@ -0,0 +1,117 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Quality.c
+   Author   : agent
+
+   Last revision: 12h59 October 18 2026
+*/
+
+#include <pebble.h>
+#include "Quality.h"
+#include "Draw2D_Batch.h"
+#include "Render3D.h"
+#include "DigitSwitch.h"
+#include "Scheduler.h"
+#include "Power.h"
+#include "Config.h"
+
+
+static Clock3D        *s_clock ;
+static Quality_Stats   s_stats ;
+static Draw2D_Backend  s_backend_full ;     // Draw2D backend to restore on QUALITY_TIER_FULL.
+static Digit2D_Type    s_digitType_full ;   // Digit type to restore below QUALITY_TIER_CHEAPDIGITS.
+static uint16_t        s_framesOverBudget ;
+static uint16_t        s_framesWithHeadroom ;
+static uint32_t        s_frameCostAvg_x16 ;  // Exponential moving average (x16 fixed point).
+
+
+static
+void
+Quality_setTier
+( const QualityTier tier )
+{
+  LOGI( "Quality_setTier:: %d -> %d (avg frame cost = %d ms)", s_stats.tier, tier, s_stats.frameCostAvg_ms ) ;
+
+  if (tier > s_stats.tier)
+    ++s_stats.stepsDown ;
+  else
+    ++s_stats.stepsUp ;
+
+  s_stats.tier = tier ;
+
+  Draw2D_setBackend( (tier >= QUALITY_TIER_NOANTIALIAS) ? DRAW2D_BACKEND_FRAMEBUFFER : s_backend_full ) ;
+  Render3D_setStrokeWidthMax( (tier >= QUALITY_TIER_THINSTROKES) ? 1 : 0 ) ;
+  Render3D_setSecond100thsRadialHidden( tier >= QUALITY_TIER_NO100THSRADIAL ) ;
+
+  const Digit2D_Type digitType = (tier >= QUALITY_TIER_CHEAPDIGITS  &&  s_digitType_full > QUALITY_DIGITTYPE_CHEAP)
+                               ? QUALITY_DIGITTYPE_CHEAP
+                               : s_digitType_full ;
+
+  // In place & spread over the next frames (see DigitSwitch.h). A pending switch may also be retargeted back.
+  if (s_clock->digitType != digitType  ||  DigitSwitch_isPending( ))
+  {
+    DigitSwitch_begin( s_clock, digitType ) ;
+
+    // Called from world_draw( ): the last frame of an animation has already decided not to schedule another one,
+    // which would leave the face half switched (mixed types) until the next tick.
+    if (DigitSwitch_isPending( )  &&  !Scheduler_isFramePending( ))
+      Scheduler_frame( Power_getPolicy( )->frameInterval_ms ) ;
+  }
+
+  s_framesOverBudget   = 0 ;
+  s_framesWithHeadroom = 0 ;
+}
+
+
+void
+Quality_initialize
+( Clock3D *clock )
+{
+  s_clock              = clock ;
+  s_stats              = (Quality_Stats){ .tier = QUALITY_TIER_FULL } ;
+  s_backend_full       = Draw2D_getBackend( ) ;
+  s_digitType_full     = clock->digitType ;
+  s_framesOverBudget   = 0 ;
+  s_framesWithHeadroom = 0 ;
+  s_frameCostAvg_x16   = 0 ;
+}
+
+
+void
+Quality_frameCost
+( const uint16_t cost_ms )
+{
+  // avg := 7/8 avg + 1/8 cost
+  s_frameCostAvg_x16      = s_frameCostAvg_x16 - (s_frameCostAvg_x16 >> 3) + ((uint32_t)cost_ms << 1) ;
+  s_stats.frameCostAvg_ms = s_frameCostAvg_x16 >> 4 ;
+
+  if (cost_ms > QUALITY_FRAMECOST_BUDGET_MS)
+  {
+    s_framesWithHeadroom = 0 ;
+
+    if (++s_framesOverBudget >= QUALITY_FRAMES_TO_STEPDOWN  &&  s_stats.tier + 1 < QUALITY_TIERS_NUM)
+      Quality_setTier( s_stats.tier + 1 ) ;
+  }
+  else
+  {
+    s_framesOverBudget = 0 ;
+
+    if ( s_stats.frameCostAvg_ms < QUALITY_FRAMECOST_HEADROOM_MS
+      && ++s_framesWithHeadroom >= QUALITY_FRAMES_TO_STEPUP
+      && s_stats.tier > QUALITY_TIER_FULL
+       )
+      Quality_setTier( s_stats.tier - 1 ) ;
+  }
+}
+
+
+bool
+Quality_isAntialiased
+( )
+{ return s_stats.tier < QUALITY_TIER_NOANTIALIAS ; }
+
+
+const Quality_Stats*
+Quality_getStats
+( )
+{ return &s_stats ; }
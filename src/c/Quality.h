@@ -0,0 +1,48 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Quality.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/Clock3D.h>
+
+
+// Ordered by ascending savings: each tier also applies all the ones before it.
+typedef enum { QUALITY_TIER_FULL
+             , QUALITY_TIER_NOANTIALIAS          // Antialiasing off: frame buffer rasterizer.
+             , QUALITY_TIER_THINSTROKES          // Stroke widths capped to 1 pixel.
+             , QUALITY_TIER_CHEAPDIGITS          // Digits switched to QUALITY_DIGITTYPE_CHEAP.
+             , QUALITY_TIER_NO100THSRADIAL       // second100ths radial dial hidden.
+             , QUALITY_TIERS_NUM
+             }
+QualityTier ;
+
+#define  QUALITY_DIGITTYPE_CHEAP        DIGIT2D_CURVYBONE
+
+// Governor tuning: frame cost is measured from the start of world_update( ) to the end of world_draw( ).
+#define  QUALITY_FRAMECOST_BUDGET_MS    36     // A bit under ANIMATION_INTERVAL_MS to leave room for the system.
+#define  QUALITY_FRAMECOST_HEADROOM_MS  18     // Step back up when the average cost falls below this.
+#define  QUALITY_FRAMES_TO_STEPDOWN      5     // Consecutive over budget frames.
+#define  QUALITY_FRAMES_TO_STEPUP       50     // Consecutive frames with headroom (slower on purpose: avoid tier flapping).
+
+
+typedef struct
+{ QualityTier  tier ;
+  uint16_t     stepsDown ;          // Tier transitions since start.
+  uint16_t     stepsUp ;
+  uint16_t     frameCostAvg_ms ;
+} Quality_Stats ;
+
+
+void  Quality_initialize( Clock3D *clock ) ;
+
+// Feeds the governor with the cost of the last frame. May step the quality tier down or up.
+void  Quality_frameCost( const uint16_t cost_ms ) ;
+
+bool                  Quality_isAntialiased( ) ;
+const Quality_Stats*  Quality_getStats( ) ;
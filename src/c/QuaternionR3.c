@@ -0,0 +1,171 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : QuaternionR3.c
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/FastMath.h>
+#include "QuaternionR3.h"
+
+
+#define  QUATERNIONR3_LERP_BELOW_COS  0.9995f   // Closer orientations than this: plain (normalized) lerp.
+
+
+// Axes are the rotation matrix columns (Shepperd's method: pivot on the largest diagonal element).
+QuaternionR3*
+QuaternionR3_fromAxes
+( QuaternionR3 *q
+, const R3     *xAxis
+, const R3     *yAxis
+, const R3     *zAxis
+)
+{
+  const float trace = xAxis->x + yAxis->y + zAxis->z ;
+
+  if (trace > 0.0f)
+  {
+    const float s = 0.5f / FastMath_sqrt( trace + 1.0f ) ;
+    q->w = 0.25f / s ;
+    q->x = (yAxis->z - zAxis->y) * s ;
+    q->y = (zAxis->x - xAxis->z) * s ;
+    q->z = (xAxis->y - yAxis->x) * s ;
+  }
+  else if (xAxis->x > yAxis->y  &&  xAxis->x > zAxis->z)
+  {
+    const float s = 2.0f * FastMath_sqrt( 1.0f + xAxis->x - yAxis->y - zAxis->z ) ;
+    q->w = (yAxis->z - zAxis->y) / s ;
+    q->x = 0.25f * s ;
+    q->y = (yAxis->x + xAxis->y) / s ;
+    q->z = (zAxis->x + xAxis->z) / s ;
+  }
+  else if (yAxis->y > zAxis->z)
+  {
+    const float s = 2.0f * FastMath_sqrt( 1.0f + yAxis->y - xAxis->x - zAxis->z ) ;
+    q->w = (zAxis->x - xAxis->z) / s ;
+    q->x = (yAxis->x + xAxis->y) / s ;
+    q->y = 0.25f * s ;
+    q->z = (zAxis->y + yAxis->z) / s ;
+  }
+  else
+  {
+    const float s = 2.0f * FastMath_sqrt( 1.0f + zAxis->z - xAxis->x - yAxis->y ) ;
+    q->w = (xAxis->y - yAxis->x) / s ;
+    q->x = (zAxis->x + xAxis->z) / s ;
+    q->y = (zAxis->y + yAxis->z) / s ;
+    q->z = 0.25f * s ;
+  }
+
+  return q ;
+}
+
+
+void
+QuaternionR3_toAxes
+( const QuaternionR3 *q
+, R3                 *xAxis
+, R3                 *yAxis
+, R3                 *zAxis
+)
+{
+  const float xx = q->x * q->x, yy = q->y * q->y, zz = q->z * q->z ;
+  const float xy = q->x * q->y, xz = q->x * q->z, yz = q->y * q->z ;
+  const float wx = q->w * q->x, wy = q->w * q->y, wz = q->w * q->z ;
+
+  *xAxis = (R3){ .x = 1.0f - 2.0f*(yy + zz), .y =        2.0f*(xy + wz), .z =        2.0f*(xz - wy) } ;
+  *yAxis = (R3){ .x =        2.0f*(xy - wz), .y = 1.0f - 2.0f*(xx + zz), .z =        2.0f*(yz + wx) } ;
+  *zAxis = (R3){ .x =        2.0f*(xz + wy), .y =        2.0f*(yz - wx), .z = 1.0f - 2.0f*(xx + yy) } ;
+}
+
+
+// acos( ) for x in [0, 1], Abramowitz & Stegun 4.4.45 (|error| < 7e-5 rad).
+static inline
+float
+QuaternionR3_acos
+( const float x )
+{
+  return FastMath_sqrt( 1.0f - x ) * (1.5707288f + x * (-0.2121144f + x * (0.0742610f + x * -0.0187293f))) ;
+}
+
+
+void
+CamR3_Transition_begin
+( CamR3_Transition *this
+, const CamR3      *from
+, const CamR3      *to
+)
+{
+  // Quaternions only describe proper rotations: a left-handed camera frame has its y axis flipped first.
+  R3 xy ;
+  R3_crossProduct( &xy, &from->xAxisVersor, &from->yAxisVersor ) ;
+  this->yAxisSign      = (R3_dotProduct( &xy, &from->zAxisVersor ) < 0.0f) ? -1.0f : +1.0f ;
+  this->viewPointSign  = (R3_dotProduct( &from->viewPoint, &from->zAxisVersor ) < 0.0f) ? -1.0f : +1.0f ;
+  this->zoom           = to->zoom ;
+  this->projectionMode = to->projectionMode ;
+
+  R3 yAxis ;
+  QuaternionR3_fromAxes( &this->from, &from->xAxisVersor, R3_scalarProduct( &yAxis, this->yAxisSign, &from->yAxisVersor ), &from->zAxisVersor ) ;
+  QuaternionR3_fromAxes( &this->to  , &to->xAxisVersor  , R3_scalarProduct( &yAxis, this->yAxisSign, &to->yAxisVersor   ), &to->zAxisVersor   ) ;
+
+  float cosTheta = this->from.w * this->to.w + this->from.x * this->to.x + this->from.y * this->to.y + this->from.z * this->to.z ;
+
+  // q & -q are the same orientation: take the shortest arc.
+  if (cosTheta < 0.0f)
+  {
+    this->to = (QuaternionR3){ .w = -this->to.w, .x = -this->to.x, .y = -this->to.y, .z = -this->to.z } ;
+    cosTheta = -cosTheta ;
+  }
+
+  if (cosTheta > QUATERNIONR3_LERP_BELOW_COS)
+  {
+    this->theta       = 0.0f ;
+    this->invSinTheta = 0.0f ;
+  }
+  else
+  {
+    this->theta       = QuaternionR3_acos( cosTheta ) ;
+    this->invSinTheta = 1.0f / FastMath_sin( this->theta ) ;
+  }
+}
+
+
+void
+CamR3_Transition_step
+( const CamR3_Transition *this
+, CamR3                  *cam
+, const float             t
+, const float             distanceFromOrigin
+)
+{
+  float kFrom, kTo ;
+
+  if (this->invSinTheta == 0.0f)
+  {
+    kFrom = 1.0f - t ;
+    kTo   = t ;
+  }
+  else
+  {
+    kFrom = FastMath_sin( (1.0f - t) * this->theta ) * this->invSinTheta ;
+    kTo   = FastMath_sin(         t  * this->theta ) * this->invSinTheta ;
+  }
+
+  QuaternionR3 q = { .w = kFrom * this->from.w + kTo * this->to.w
+                   , .x = kFrom * this->from.x + kTo * this->to.x
+                   , .y = kFrom * this->from.y + kTo * this->to.y
+                   , .z = kFrom * this->from.z + kTo * this->to.z
+                   } ;
+
+  // Slerp keeps unit length up to FastMath precision, the lerp fallback does not.
+  const float invModulus = 1.0f / FastMath_sqrt( q.w*q.w + q.x*q.x + q.y*q.y + q.z*q.z ) ;
+  q.w *= invModulus ; q.x *= invModulus ; q.y *= invModulus ; q.z *= invModulus ;
+
+  QuaternionR3_toAxes( &q, &cam->xAxisVersor, &cam->yAxisVersor, &cam->zAxisVersor ) ;
+  R3_scalarProduct( &cam->yAxisVersor, this->yAxisSign, &cam->yAxisVersor ) ;
+  R3_scalarProduct( &cam->viewPoint, this->viewPointSign * distanceFromOrigin, &cam->zAxisVersor ) ;
+
+  cam->zoom           = this->zoom ;
+  cam->projectionMode = this->projectionMode ;
+}
@@ -0,0 +1,41 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : QuaternionR3.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <karambola/R3.h>
+#include <karambola/CamR3.h>
+
+
+typedef struct
+{ float  w, x, y, z ;
+} QuaternionR3 ;
+
+
+// Camera orientation transition: start/end orientations & slerp constants are derived once,
+// each intermediate frame then costs two sines and a quaternion -> axes conversion.
+typedef struct
+{ QuaternionR3       from ;
+  QuaternionR3       to ;
+  float              theta ;               // Angle between from & to (shortest arc).
+  float              invSinTheta ;         // 0: from & to (almost) coincide, lerp instead.
+  float              viewPointSign ;       // Viewpoint side of the camera z axis.
+  float              yAxisSign ;           // -1.0f for left-handed camera frames.
+  float              zoom ;
+  CamProjectionMode  projectionMode ;
+} CamR3_Transition ;
+
+
+QuaternionR3*  QuaternionR3_fromAxes( QuaternionR3 *q, const R3 *xAxis, const R3 *yAxis, const R3 *zAxis ) ;
+void           QuaternionR3_toAxes  ( const QuaternionR3 *q, R3 *xAxis, R3 *yAxis, R3 *zAxis ) ;
+
+// Both cameras are expected to look at the origin from the same distance.
+void  CamR3_Transition_begin( CamR3_Transition *this, const CamR3 *from, const CamR3 *to ) ;
+
+// t in [0.0, 1.0]: 0.0 is the from camera, 1.0 the to camera.
+void  CamR3_Transition_step( const CamR3_Transition *this, CamR3 *cam, const float t, const float distanceFromOrigin ) ;
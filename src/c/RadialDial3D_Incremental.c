@@ -0,0 +1,370 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : RadialDial3D_Incremental.c
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/Binary.h>
+#include "RadialDial3D_Incremental.h"
+#include "Config.h"
+
+
+typedef struct
+{ RadialDial3D         *radial ;
+  bool                  isSpoke ;           // Learned: value v lights edge (v + offset) % edgesNum over a fixed background.
+  uint16_t              offset ;
+  unsigned char        *background_L2R ;    // Edges lit whatever the value.
+  int8_t                value ;             // Value the active list was built for.
+  DigitTemplates_Value  active ;
+  uint8_t              *vertexRefs ;        // Active edges referencing each vertex.
+} RadialDial3D_Track ;
+
+static RadialDial3D_Track  s_tracks[RADIALDIAL3D_TRACKS_MAX] ;
+
+
+// Rebuilds the active list from the mesh edge states.
+static
+void
+RadialDial3D_sync
+( RadialDial3D_Track *track )
+{
+  const MeshR3   *mesh     = track->radial->mesh ;
+  const uint16_t  edgesNum = mesh->edgeInfo->edgesNum ;
+  const Edge     *edges    = mesh->edgeInfo->edges ;
+
+  memset( track->vertexRefs, 0, mesh->verticesNum ) ;
+  track->active.edgesNum    = 0 ;
+  track->active.verticesNum = 0 ;
+
+  for ( uint16_t e = 0  ;  e < edgesNum  ;  ++e )
+    if (!mesh->edgesState[e].isDisabled)
+    {
+      track->active.edges[track->active.edgesNum++] = e ;
+      ++track->vertexRefs[edges[e].v1] ;
+      ++track->vertexRefs[edges[e].v2] ;
+    }
+
+  for ( uint16_t v = 0  ;  v < mesh->verticesNum  ;  ++v )
+    if (track->vertexRefs[v] > 0)
+      track->active.vertices[track->active.verticesNum++] = v ;
+
+  track->value = track->radial->value ;
+}
+
+
+// Sorted insertion / removal in the active lists.
+static
+void
+RadialDial3D_vertexAdd
+( RadialDial3D_Track *track
+, const uint8_t       v
+)
+{
+  if (track->vertexRefs[v]++ > 0)
+    return ;
+
+  uint16_t i = track->active.verticesNum++ ;
+
+  for ( ; i > 0  &&  track->active.vertices[i-1] > v  ;  --i )
+    track->active.vertices[i] = track->active.vertices[i-1] ;
+
+  track->active.vertices[i] = v ;
+}
+
+
+static
+void
+RadialDial3D_vertexRemove
+( RadialDial3D_Track *track
+, const uint8_t       v
+)
+{
+  if (track->vertexRefs[v] == 0  ||  --track->vertexRefs[v] > 0)
+    return ;
+
+  uint16_t i = 0 ;
+
+  while (track->active.vertices[i] != v)
+    ++i ;
+
+  memmove( track->active.vertices + i, track->active.vertices + i + 1, --track->active.verticesNum - i ) ;
+}
+
+
+static
+void
+RadialDial3D_edgeLight
+( RadialDial3D_Track *track
+, const uint16_t      e
+, const bool          isLit
+)
+{
+  MeshR3     *mesh = track->radial->mesh ;
+  const Edge *edge = mesh->edgeInfo->edges + e ;
+
+  if (mesh->edgesState[e].isDisabled == !isLit)
+    return ;
+
+  mesh->edgesState[e].isDisabled = !isLit ;
+
+  if (isLit)
+  {
+    uint16_t i = track->active.edgesNum++ ;
+
+    for ( ; i > 0  &&  track->active.edges[i-1] > e  ;  --i )
+      track->active.edges[i] = track->active.edges[i-1] ;
+
+    track->active.edges[i] = e ;
+    RadialDial3D_vertexAdd( track, edge->v1 ) ;
+    RadialDial3D_vertexAdd( track, edge->v2 ) ;
+  }
+  else
+  {
+    uint16_t i = 0 ;
+
+    while (track->active.edges[i] != e)
+      ++i ;
+
+    memmove( track->active.edges + i, track->active.edges + i + 1, (--track->active.edgesNum - i) * sizeof(uint16_t) ) ;
+    RadialDial3D_vertexRemove( track, edge->v1 ) ;
+    RadialDial3D_vertexRemove( track, edge->v2 ) ;
+  }
+}
+
+
+// Lit edges of the current value, as a bit string.
+static
+void
+RadialDial3D_litEdges
+( const MeshR3  *mesh
+, unsigned char *lit_L2R
+)
+{
+  const uint16_t edgesNum = mesh->edgeInfo->edgesNum ;
+
+  memset( lit_L2R, 0, (edgesNum + 7) >> 3 ) ;
+
+  for ( uint16_t e = 0  ;  e < edgesNum  ;  ++e )
+    if (!mesh->edgesState[e].isDisabled)
+      Binary_setL2R( lit_L2R, e ) ;
+}
+
+
+// Learns the package encoding from two values, far apart and off the tick marks, then restores the value.
+static
+void
+RadialDial3D_learn
+( RadialDial3D_Track *track )
+{
+  RadialDial3D   *radial   = track->radial ;
+  const uint16_t  edgesNum = radial->mesh->edgeInfo->edgesNum ;
+  const int8_t    value    = radial->value ;
+  const uint8_t   a        = 1 ;
+  const uint8_t   b        = edgesNum / 2 + 1 ;
+  unsigned char   litA_L2R[(UINT8_MAX + 1) >> 3] ;
+  int             edgeA    = -1, edgeB = -1 ;
+
+  track->isSpoke = false ;
+
+  if (edgesNum < 4  ||  edgesNum > UINT8_MAX + 1)
+    return ;
+
+  RadialDial3D_setValue( radial, a ) ;
+  RadialDial3D_litEdges( radial->mesh, litA_L2R ) ;
+  RadialDial3D_setValue( radial, b ) ;
+  RadialDial3D_litEdges( radial->mesh, track->background_L2R ) ;
+
+  // Background: lit on both. Exactly one edge lit only on each value, at the same offset, for a single spoke encoding.
+  for ( uint16_t e = 0  ;  e < edgesNum  ;  ++e )
+  {
+    const bool isLitA = Binary_isSetL2R( litA_L2R, e ) ;
+    const bool isLitB = Binary_isSetL2R( track->background_L2R, e ) ;
+
+    if (isLitA == isLitB)
+      continue ;
+
+    int *edge = isLitA ? &edgeA : &edgeB ;
+
+    if (*edge >= 0)
+    {
+      edgeA = -1 ;
+      break ;
+    }
+
+    *edge = e ;
+
+    // Not in the background: clear its bit (litA is only read from now on).
+    if (isLitB)
+      track->background_L2R[e >> 3] &= ~(0x80 >> (e & 7)) ;
+  }
+
+  if ( edgeA >= 0  &&  edgeB >= 0
+    && (edgeA - a + edgesNum) % edgesNum == (edgeB - b + edgesNum) % edgesNum
+     )
+  {
+    track->isSpoke = true ;
+    track->offset  = (edgeA - a + edgesNum) % edgesNum ;
+  }
+
+  if (value >= 0)
+    RadialDial3D_setValue( radial, value ) ;
+  else
+    RadialDial3D_setNull( radial ) ;
+
+  LOGI( "RadialDial3D_learn:: %d edges, %s, offset = %d", edgesNum, track->isSpoke ? "single spoke" : "full rewrite", track->offset ) ;
+}
+
+
+// Tracked radials only: the others are left to the package.
+static
+RadialDial3D_Track*
+RadialDial3D_track
+( const RadialDial3D *radial )
+{
+  if (radial == NULL)
+    return NULL ;
+
+  for ( uint8_t i = 0  ;  i < RADIALDIAL3D_TRACKS_MAX  ;  ++i )
+    if (s_tracks[i].radial == radial)
+      return s_tracks + i ;
+
+  return NULL ;
+}
+
+
+// Learns the radial encoding and starts tracking it if it is a single spoke one.
+static
+void
+RadialDial3D_trackNew
+( RadialDial3D *radial )
+{
+  // Vertex indexes are kept as uint8_t, as in the digit lists.
+  if ( radial == NULL  ||  radial->mesh == NULL  ||  radial->mesh->edgeInfo == NULL
+    || radial->mesh->verticesNum > UINT8_MAX + 1
+    || RadialDial3D_track( radial ) != NULL
+     )
+    return ;
+
+  RadialDial3D_Track *free_ = NULL ;
+
+  for ( uint8_t i = 0  ;  i < RADIALDIAL3D_TRACKS_MAX  &&  free_ == NULL  ;  ++i )
+    if (s_tracks[i].radial == NULL)
+      free_ = s_tracks + i ;
+
+  if (free_ == NULL)
+    return ;
+
+  // One block: active edges, background bits, active vertices & vertex reference counts.
+  const uint16_t edgesNum    = radial->mesh->edgeInfo->edgesNum ;
+  const uint16_t verticesNum = radial->mesh->verticesNum ;
+  const size_t   bitsSize    = (edgesNum + 7) >> 3 ;
+  uint8_t       *block       = malloc( edgesNum * sizeof(uint16_t) + bitsSize + 2 * verticesNum ) ;
+
+  if (block == NULL)
+    return ;
+
+  *free_ = (RadialDial3D_Track){ .radial         = radial
+                               , .active         = { .edges = (uint16_t *)block }
+                               , .background_L2R = block + edgesNum * sizeof(uint16_t)
+                               } ;
+  free_->active.vertices = free_->background_L2R + bitsSize ;
+  free_->vertexRefs      = free_->active.vertices + verticesNum ;
+
+  RadialDial3D_learn( free_ ) ;
+
+  // Full rewrite encodings gain nothing from an active list that has to be rebuilt on each value change.
+  if (!free_->isSpoke)
+  {
+    free( block ) ;
+    *free_ = (RadialDial3D_Track){ .radial = NULL } ;
+    return ;
+  }
+
+  RadialDial3D_sync( free_ ) ;
+}
+
+
+void
+RadialDial3D_Incremental_initialize
+( Clock3D *clock )
+{
+  RadialDial3D_trackNew( clock->hours_radial   ) ;
+  RadialDial3D_trackNew( clock->minutes_radial ) ;
+  RadialDial3D_trackNew( clock->seconds_radial ) ;
+#ifdef CLOCK3D_SECOND100THS_RADIAL
+  RadialDial3D_trackNew( clock->second100ths_radial ) ;
+#endif
+}
+
+
+void
+RadialDial3D_setValueIncremental
+( RadialDial3D  *this
+, const uint8_t  value
+)
+{
+  RadialDial3D_Track *track = RadialDial3D_track( this ) ;
+
+  if (track == NULL)
+  {
+    RadialDial3D_setValue( this, value ) ;
+    return ;
+  }
+
+  // Changed by the package meanwhile (Clock3D animations).
+  if (track->value != this->value)
+    RadialDial3D_sync( track ) ;
+
+  if (this->value == value)
+    return ;
+
+  if (this->value < 0)
+  {
+    RadialDial3D_setValue( this, value ) ;
+    RadialDial3D_sync( track ) ;
+    return ;
+  }
+
+  const uint16_t edgesNum = this->mesh->edgeInfo->edgesNum ;
+  const uint16_t edgeOld  = (this->value + track->offset) % edgesNum ;
+  const uint16_t edgeNew  = (value       + track->offset) % edgesNum ;
+
+  // Background edges (alternate stroke ticks) are never touched: they stay lit & in the active list.
+  if (!Binary_isSetL2R( track->background_L2R, edgeOld ))
+    RadialDial3D_edgeLight( track, edgeOld, false ) ;
+
+  RadialDial3D_edgeLight( track, edgeNew, true ) ;
+
+  this->value = track->value = value ;
+}
+
+
+const DigitTemplates_Value*
+RadialDial3D_active
+( RadialDial3D *this )
+{
+  RadialDial3D_Track *track = RadialDial3D_track( this ) ;
+
+  if (track == NULL)
+    return NULL ;
+
+  if (track->value != this->value)
+    RadialDial3D_sync( track ) ;
+
+  return &track->active ;
+}
+
+
+void
+RadialDial3D_Incremental_finalize
+( )
+{
+  for ( uint8_t i = 0  ;  i < RADIALDIAL3D_TRACKS_MAX  ;  ++i )
+  {
+    free( s_tracks[i].active.edges ) ;   // Block start.
+    s_tracks[i] = (RadialDial3D_Track){ .radial = NULL } ;
+  }
+}
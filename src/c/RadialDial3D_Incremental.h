@@ -0,0 +1,34 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : RadialDial3D_Incremental.h
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/RadialDial3D.h>
+#include <karambola/Clock3D.h>
+#include "DigitTemplates.h"
+
+
+// Each tracked radial keeps its lit edges (and the vertices they reference) as an active list, same layout as
+// the digit value lists, so that Render3D only scans those. At config time the package value encoding is learned
+// (two RadialDial3D_setValue( ) calls, then the value is restored): only radials where a value lights a single
+// spoke over a fixed background (ticks) are tracked, a value change then only flips the old & new spoke edges.
+
+#define  RADIALDIAL3D_TRACKS_MAX   4
+
+
+// Learns & tracks the clock radials: after Clock3D_config( ) and after any package call that rebuilds them.
+void  RadialDial3D_Incremental_initialize( Clock3D *clock ) ;
+
+// RadialDial3D_setValue( ) replacement: O(1) edge updates for tracked radials, plain package call otherwise.
+void  RadialDial3D_setValueIncremental( RadialDial3D *this, const uint8_t value ) ;
+
+// Lit edges & referenced vertices, resynced if the package changed the value meanwhile. NULL if not tracked.
+const DigitTemplates_Value*  RadialDial3D_active( RadialDial3D *this ) ;
+
+void  RadialDial3D_Incremental_finalize( ) ;
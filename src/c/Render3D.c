@@ -0,0 +1,685 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Render3D.c
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#include <pebble.h>
+#include <karambola/R3.h>
+#include <karambola/Binary.h>
+#include <karambola/FastMath.h>
+
+#include "Render3D.h"
+#include "Clip2D.h"
+#include "CamR3_Projection.h"
+#include "Kernel3D.h"
+#include "DigitTemplates.h"
+#include "RadialDial3D_Incremental.h"
+#include "Scheduler.h"
+#include "Config.h"
+
+
+// Scratch buffers, grown on demand to the largest mesh seen so far.
+static GPoint         *s_screenPoint    = NULL ;
+static uint16_t        s_screenPointMax = 0 ;
+static Draw2D_Segment *s_segment        = NULL ;
+static Edge           *s_run            = NULL ;   // Vertex indexes of each segment (before projection).
+static uint16_t        s_segmentMax     = 0 ;
+
+static CamR3_Projection  s_projection ;   // Fused view matrix of the current camera.
+
+static Render3D_Stats  s_stats ;
+static uint8_t         s_strokeWidthMax              = 0 ;
+static bool            s_isSecond100thsRadialHidden  = false ;
+
+
+static
+bool
+Render3D_reserve
+( const uint16_t verticesNum
+, const uint16_t edgesNum
+)
+{
+  if (verticesNum > s_screenPointMax)
+  {
+    GPoint *screenPoint = realloc( s_screenPoint, verticesNum * sizeof(GPoint) ) ;
+
+    if (screenPoint == NULL)
+      return false ;
+
+    s_screenPoint    = screenPoint ;
+    s_screenPointMax = verticesNum ;
+  }
+
+  if (edgesNum > s_segmentMax)
+  {
+    Draw2D_Segment *segment = realloc( s_segment, edgesNum * sizeof(Draw2D_Segment) ) ;
+
+    if (segment == NULL)
+      return false ;
+
+    s_segment = segment ;
+
+    Edge *run = realloc( s_run, edgesNum * sizeof(Edge) ) ;
+
+    if (run == NULL)
+      return false ;
+
+    s_run        = run ;
+    s_segmentMax = edgesNum ;
+  }
+
+  return true ;
+}
+
+
+void
+Render3D_initialize
+( )
+{
+  s_stats      = (Render3D_Stats){ 0 } ;
+  s_projection = (CamR3_Projection){ 0 } ;
+}
+
+
+void
+Render3D_finalize
+( )
+{
+  free( s_screenPoint ) ; s_screenPoint = NULL ; s_screenPointMax = 0 ;
+  free( s_segment     ) ; s_segment     = NULL ;
+  free( s_run         ) ; s_run         = NULL ; s_segmentMax     = 0 ;
+
+  DigitTemplates_finalize( ) ;
+  RadialDial3D_Incremental_finalize( ) ;
+}
+
+
+const Render3D_Stats*
+Render3D_getStats
+( )
+{ return &s_stats ; }
+
+
+void
+Render3D_setStrokeWidthMax
+( const uint8_t strokeWidthMax )
+{ s_strokeWidthMax = strokeWidthMax ; }
+
+
+void
+Render3D_setSecond100thsRadialHidden
+( const bool isHidden )
+{ s_isSecond100thsRadialHidden = isHidden ; }
+
+
+static inline
+uint8_t
+Render3D_strokeWidth
+( const uint8_t strokeWidth )
+{
+  return (s_strokeWidthMax != 0  &&  strokeWidth > s_strokeWidthMax) ? s_strokeWidthMax : strokeWidth ;
+}
+
+
+// Is the (outer side of) the plane defined by point & normal visible from the camera ?
+static inline
+bool
+Render3D_isFacingCam
+( const R3    *normal
+, const R3    *point
+, const CamR3 *cam
+)
+{ return Kernel3D_isFacing( normal, point, &cam->viewPoint ) ; }
+
+
+// World bounding sphere: center of the axis aligned bounding box, radius to its corners. Active vertices only if any.
+static
+float
+Render3D_boundingSphere
+( const Vertex               *vertices
+, const uint16_t              verticesNum
+, const DigitTemplates_Value *active
+, R3                         *center
+)
+{
+  R3 min, max ;
+
+  if (active != NULL)
+    Kernel3D_boundsIndexed( &vertices->worldCoord, sizeof(Vertex), active->vertices, active->verticesNum, &min, &max ) ;
+  else
+    Kernel3D_bounds( &vertices->worldCoord, sizeof(Vertex), verticesNum, &min, &max ) ;
+
+  *center = (R3){ .x = 0.5f * (min.x + max.x), .y = 0.5f * (min.y + max.y), .z = 0.5f * (min.z + max.z) } ;
+
+  const R3 half = { .x = max.x - center->x, .y = max.y - center->y, .z = max.z - center->z } ;
+
+  return FastMath_sqrt( half.x*half.x + half.y*half.y + half.z*half.z ) ;
+}
+
+
+// Is p within RENDER3D_LOD_TOLERANCE_PX of the chord a-b, and between its ends ?
+static inline
+bool
+Render3D_isOnChord
+( const GPoint a
+, const GPoint b
+, const GPoint p
+)
+{
+  const int32_t dx   = b.x - a.x, dy = b.y - a.y ;
+  const int32_t px   = p.x - a.x, py = p.y - a.y ;
+  const int64_t len2 = (int64_t)dx*dx + (int64_t)dy*dy ;
+  const int64_t dot  = (int64_t)px*dx + (int64_t)py*dy ;
+
+  if (len2 == 0  ||  dot < 0  ||  dot > len2)
+    return false ;
+
+  const int64_t cross = (int64_t)dx*py - (int64_t)dy*px ;
+
+  return cross * cross <= (int64_t)RENDER3D_LOD_TOLERANCE_PX * RENDER3D_LOD_TOLERANCE_PX * len2 ;
+}
+
+
+// Joins consecutive chained segments sharing the same stroke state, up to runLengthMax edges per run, as long as every
+// dropped vertex stays on the chord (screen space). A run never closes on itself. Compacts in place, returns the count.
+static
+uint16_t
+Render3D_mergeRuns
+( const uint16_t segmentsNum
+, const uint16_t runLengthMax
+)
+{
+  uint16_t dropped[RENDER3D_RUN_MAX - 1] ;   // Interior vertices of the current run.
+  uint16_t droppedNum = 0 ;
+  uint16_t runsNum    = 0 ;
+
+  for ( uint16_t s = 0  ;  s < segmentsNum  ;  ++s )
+  {
+    Edge       *run        = (runsNum > 0) ? s_run + runsNum - 1 : NULL ;
+    const Edge  edge       = s_run[s] ;
+    bool        isExtended = false ;
+
+    if ( run != NULL
+      && droppedNum + 1 < runLengthMax  &&  droppedNum + 1 < RENDER3D_RUN_MAX
+      && run->v2 == edge.v1
+      && edge.v2 != run->v1
+      && s_segment[runsNum-1].ink         == s_segment[s].ink
+      && s_segment[runsNum-1].isAlternate == s_segment[s].isAlternate
+       )
+    {
+      const GPoint a = s_screenPoint[run->v1] ;
+      const GPoint b = s_screenPoint[edge.v2] ;
+
+      isExtended = Render3D_isOnChord( a, b, s_screenPoint[edge.v1] ) ;
+
+      for ( uint16_t d = 0  ;  isExtended  &&  d < droppedNum  ;  ++d )
+        isExtended = Render3D_isOnChord( a, b, s_screenPoint[dropped[d]] ) ;
+    }
+
+    if (isExtended)
+    {
+      dropped[droppedNum++] = edge.v1 ;
+      run->v2               = edge.v2 ;
+    }
+    else
+    {
+      s_run[runsNum]     = edge ;
+      s_segment[runsNum] = s_segment[s] ;
+      ++runsNum ;
+      droppedNum = 0 ;
+    }
+  }
+
+  return runsNum ;
+}
+
+
+// active: if not NULL, the only edges that may be enabled (see DigitTemplates.h), all others are skipped unseen.
+// skipped_L2R: if not NULL, edges left out of this frame (see Render3D_digit( )).
+static
+void
+Render3D_meshActive
+( DisplayList                *list
+, MeshR3                     *mesh
+, const DigitTemplates_Value *active
+, const unsigned char        *skipped_L2R
+, const CamR3                *cam
+, const int                   w
+, const int                   h
+, const MeshTransparency      transparency
+, const uint8_t               lod
+)
+{
+  if (mesh == NULL  ||  mesh->state.isDisabled  ||  mesh->state.isHidden  ||  mesh->edgeInfo == NULL)
+    return ;
+
+  // A blinker (re)started by the package still runs on an unaligned AppTimer: phase aligned with the frames.
+  Scheduler_alignBlinker( mesh->inkBlinker ) ;
+
+  const ink_t meshInk = (mesh->inkBlinker != NULL) ? mesh->inkBlinker->value : INK100 ;
+
+  if (meshInk == INK0)
+    return ;
+
+  const uint16_t  verticesNum = mesh->verticesNum ;
+  const uint16_t  edgesNum    = mesh->edgeInfo->edgesNum ;
+  const Edge     *edges       = mesh->edgeInfo->edges ;
+  Vertex         *vertices    = mesh->vertices ;
+  ViewFlags      *edgesState  = mesh->edgesState ;
+
+  if (verticesNum == 0  ||  edgesNum == 0  ||  (active != NULL  &&  active->edgesNum == 0))
+    return ;
+
+  const uint16_t  scanNum     = (active != NULL) ? active->edgesNum : edgesNum ;
+
+  // Planar meshes are invisible when seen from behind.
+  if ( mesh->normal_worldCoord != NULL
+    && transparency == MESH_TRANSPARENCY_SOLID
+    && !Render3D_isFacingCam( mesh->normal_worldCoord, &vertices[0].worldCoord, cam )
+     )
+    return ;
+
+  // Whole mesh off screen (zoomed in, or viewpoint close to a face) ?
+  CamR3_Projection_update( &s_projection, cam, w, h ) ;
+
+  R3          sphereCenter ;
+  const float sphereRadius = Render3D_boundingSphere( vertices, verticesNum, active, &sphereCenter ) ;
+
+  if (!CamR3_Projection_isSphereVisible( &s_projection, &sphereCenter, sphereRadius ))
+  {
+    ++s_stats.meshesCulled ;
+    return ;
+  }
+
+  // Mesh reaching behind the near plane: its edges are checked one by one.
+  const bool isNear = CamR3_Projection_isSphereNear( &s_projection, &sphereCenter, sphereRadius ) ;
+
+  if (!Render3D_reserve( verticesNum, edgesNum ))
+  {
+    LOGE( "Render3D_mesh:: out of memory for %d vertices, %d edges", verticesNum, edgesNum ) ;
+    return ;
+  }
+
+  // Edges are hidden unless they belong to at least one face facing the camera.
+  for ( uint16_t i = 0  ;  i < scanNum  ;  ++i )
+    edgesState[(active != NULL) ? active->edges[i] : i].isHidden = (mesh->facesNum > 0) ;
+
+  for ( uint16_t f = 0  ;  f < mesh->facesNum  ;  ++f )
+  {
+    Face           *face     = mesh->faces + f ;
+    const FaceInfo *faceInfo = face->faceInfo ;
+
+    face->state.isHidden = !Render3D_isFacingCam( &face->normal_worldCoord
+                                                , &vertices[edges[faceInfo->edgeIndexes[0]].v1].worldCoord
+                                                , cam
+                                                ) ;
+    if (!face->state.isHidden)
+      for ( uint16_t i = 0  ;  i < faceInfo->edgesNum  ;  ++i )
+        edgesState[faceInfo->edgeIndexes[i]].isHidden = false ;
+  }
+
+  // Collect the drawable edges, one segment each.
+  uint16_t segmentsNum = 0 ;
+
+  for ( uint16_t i = 0  ;  i < scanNum  ;  ++i )
+  {
+    const uint16_t  e         = (active != NULL) ? active->edges[i] : i ;
+    const ViewFlags edgeState = edgesState[e] ;
+
+    if ( edgeState.isDisabled
+      || (edgeState.isHidden  &&  transparency == MESH_TRANSPARENCY_SOLID)
+      || (skipped_L2R != NULL  &&  Binary_isSetL2R( skipped_L2R, e ))
+      || ( isNear
+        && ( CamR3_Projection_isBehindNear( &s_projection, &vertices[edges[e].v1].worldCoord )
+          || CamR3_Projection_isBehindNear( &s_projection, &vertices[edges[e].v2].worldCoord )
+           )
+         )
+       )
+      continue ;
+
+    s_run[segmentsNum]                 = edges[e] ;
+    s_segment[segmentsNum].ink         = (edgeState.isHidden  &&  transparency == MESH_TRANSPARENCY_XRAY) ? INK33 : meshInk ;
+    s_segment[segmentsNum].isAlternate = mesh->edgeAlternateMask_L2R != NULL  &&  Binary_isSetL2R( mesh->edgeAlternateMask_L2R, e ) ;
+    ++segmentsNum ;
+  }
+
+  // Mark the vertices referenced by segments, so that each one is projected only once.
+  for ( uint16_t v = 0  ;  v < verticesNum  ;  ++v )
+    vertices[v].state.isHidden = true ;
+
+  for ( uint16_t s = 0  ;  s < segmentsNum  ;  ++s )
+  {
+    vertices[s_run[s].v1].state.isHidden = false ;
+    vertices[s_run[s].v2].state.isHidden = false ;
+  }
+
+  CamR3_Projection_vertices( &s_projection, vertices, verticesNum, s_screenPoint ) ;
+
+  if (lod != RENDER3D_LOD_FULL)
+    segmentsNum = Render3D_mergeRuns( segmentsNum, 1 << lod ) ;
+
+  // Project & clip the batch (compacting away the rejected segments).
+  uint16_t visibleNum = 0 ;
+
+  for ( uint16_t s = 0  ;  s < segmentsNum  ;  ++s )
+  {
+    Draw2D_Segment *segment = s_segment + visibleNum ;
+    *segment    = s_segment[s] ;
+    segment->p0 = s_screenPoint[s_run[s].v1] ;
+    segment->p1 = s_screenPoint[s_run[s].v2] ;
+
+    if (Clip2D_segment( &segment->p0, &segment->p1 ))
+      ++visibleNum ;
+  }
+
+  s_stats.segmentsDrawn += visibleNum ;
+
+  DisplayList_addBatch( list
+                      , &(Draw2D_Stroke){ .width = Render3D_strokeWidth( mesh->strokeWidth          ), .color = mesh->strokeColor          }
+                      , &(Draw2D_Stroke){ .width = Render3D_strokeWidth( mesh->strokeWidthAlternate ), .color = mesh->strokeColorAlternate }
+                      , s_segment
+                      , visibleNum
+                      ) ;
+}
+
+
+bool
+Render3D_calibrate
+( GContext     *gCtx
+, MeshR3       *mesh
+, const CamR3  *cam
+, const int     w
+, const int     h
+)
+{ return CamR3_Projection_calibrate( &s_projection, gCtx, mesh, cam, w, h ) ; }
+
+
+void
+Render3D_mesh
+( DisplayList            *list
+, MeshR3                 *mesh
+, const CamR3            *cam
+, const int               w
+, const int               h
+, const MeshTransparency  transparency
+, const uint8_t           lod
+)
+{ Render3D_meshActive( list, mesh, NULL, NULL, cam, w, h, transparency, lod ) ; }
+
+
+// Projected size (pixels) of a cube face holding a planar mesh: shrinks with distance and viewing angle.
+static
+int
+Render3D_faceSizePx
+( const MeshR3 *mesh
+, const CamR3  *cam
+, const int     w
+, const int     h
+)
+{
+  if (mesh == NULL  ||  mesh->normal_worldCoord == NULL  ||  mesh->verticesNum == 0)
+    return RENDER3D_LOD_HALF_BELOW_PX + RENDER3D_LOD_HYSTERESIS_PX ;   // Unknown: keep it on full detail.
+
+  R3 toCam ;
+  R3_sub( &toCam, &cam->viewPoint, &mesh->vertices[0].worldCoord ) ;
+
+  const float distance2 = R3_dotProduct( &toCam, &toCam ) ;
+
+  if (distance2 <= 0.0f)
+    return 0 ;
+
+  // size ~ zoom * cos(angle) / distance, with cos(angle) = (toCam . normal) / distance
+  const float scale = (w < h) ? w : h ;
+
+  return (int)(scale * CUBE_SIZE * cam->zoom * R3_dotProduct( &toCam, mesh->normal_worldCoord ) / distance2) ;
+}
+
+
+// Select the face LOD with hysteresis, so that a face hovering around a threshold does not keep popping.
+static
+uint8_t
+Render3D_selectLOD
+( const Render3D_Face  face
+, const int            sizePx
+)
+{
+  const uint8_t lodOld = s_stats.faceLOD[face] ;
+  const int     bias   = (lodOld == RENDER3D_LOD_FULL) ? -RENDER3D_LOD_HYSTERESIS_PX : +RENDER3D_LOD_HYSTERESIS_PX ;
+  uint8_t       lod ;
+
+  if (sizePx >= RENDER3D_LOD_HALF_BELOW_PX + bias)
+    lod = RENDER3D_LOD_FULL ;
+  else if (sizePx >= RENDER3D_LOD_QUARTER_BELOW_PX + ((lodOld == RENDER3D_LOD_QUARTER) ? +RENDER3D_LOD_HYSTERESIS_PX : -RENDER3D_LOD_HYSTERESIS_PX))
+    lod = RENDER3D_LOD_HALF ;
+  else
+    lod = RENDER3D_LOD_QUARTER ;
+
+  if (lod != lodOld)
+  {
+    LOGD( "Render3D_selectLOD:: face = %d, sizePx = %d, LOD %d -> %d", face, sizePx, lodOld, lod ) ;
+    s_stats.faceLOD[face] = lod ;
+    ++s_stats.lodChanges ;
+  }
+
+  return lod ;
+}
+
+
+static inline
+void
+Render3D_digit
+( DisplayList            *list
+, Digit3D                *digit
+, const CamR3            *cam
+, const int               w
+, const int               h
+, const MeshTransparency  transparency
+, const uint8_t           lod
+)
+{
+  if (digit == NULL  ||  digit->mesh == NULL)
+    return ;
+
+  // Decoded value edge map, if the mesh really is built from the type template.
+  const DigitTemplates_Value *active = ( digit->type < DIGIT2D_TYPES_NUM
+                                      && digit->mesh->edgeInfo == DIGIT_TEMPLATES[digit->type].edgeInfo
+                                       )
+                                     ? DigitTemplates_value( digit->type, digit->value )
+                                     : NULL ;
+
+  // Two stroke types (skin & bone) drop their alternate stroke layer at QUARTER: either layer alone still shapes the digit.
+  const unsigned char *skipped_L2R = ( lod >= RENDER3D_LOD_QUARTER
+                                    && active != NULL
+                                    && DIGIT_TEMPLATES[digit->type].boneMask_L2R != NULL
+                                     )
+                                   ? digit->mesh->edgeAlternateMask_L2R
+                                   : NULL ;
+
+  Render3D_meshActive( list, digit->mesh, active, skipped_L2R, cam, w, h, transparency, lod ) ;
+}
+
+
+static inline
+void
+Render3D_radial
+( DisplayList            *list
+, RadialDial3D           *radial
+, const CamR3            *cam
+, const int               w
+, const int               h
+, const MeshTransparency  transparency
+)
+{
+  // Only the lit edges are scanned (see RadialDial3D_Incremental.h).
+  if (radial != NULL)
+    Render3D_meshActive( list, radial->mesh, RadialDial3D_active( radial ), NULL, cam, w, h, transparency, RENDER3D_LOD_FULL ) ;
+}
+
+
+static inline
+uint8_t
+Render3D_faceLOD
+( const Render3D_Face  face
+, Digit3D             *digit      // Any digit of the face: all share the face plane when not flipping.
+, const CamR3         *cam
+, const int            w
+, const int            h
+)
+{
+  return Render3D_selectLOD( face, Render3D_faceSizePx( (digit != NULL) ? digit->mesh : NULL, cam, w, h ) ) ;
+}
+
+
+// Largest lit edge count over the digit values, for every type the digit may be switched to (up to its typeMax,
+// see DigitSwitch.h). A mesh not built from its type template is bounded by its own edge count.
+static
+uint16_t
+Render3D_digitEdgesMax
+( const Digit3D *digit )
+{
+  if (digit == NULL  ||  digit->mesh == NULL  ||  digit->mesh->edgeInfo == NULL)
+    return 0 ;
+
+  const bool         isTemplate = digit->type < DIGIT2D_TYPES_NUM  &&  digit->mesh->edgeInfo == DIGIT_TEMPLATES[digit->type].edgeInfo ;
+  const Digit2D_Type typeMax    = (digit->typeMax < DIGIT2D_TYPES_NUM) ? digit->typeMax : DIGIT2D_TYPES_NUM - 1 ;
+  uint16_t           edgesMax   = isTemplate ? 0 : digit->mesh->edgeInfo->edgesNum ;
+
+  for ( uint8_t type = 0  ;  type <= typeMax  ;  ++type )
+  {
+    const uint16_t edgesNum = DigitTemplates_edgesMax( type ) ;
+
+    if (edgesNum > edgesMax)
+      edgesMax = edgesNum ;
+  }
+
+  return edgesMax ;
+}
+
+
+static inline
+uint16_t
+Render3D_radialEdges
+( const RadialDial3D *radial )
+{ return (radial != NULL  &&  radial->mesh != NULL  &&  radial->mesh->edgeInfo != NULL) ? radial->mesh->edgeInfo->edgesNum : 0 ; }
+
+
+uint16_t
+Render3D_segmentsMax
+( const Clock3D          *clock
+, const MeshTransparency  transparency
+, uint16_t               *batchesMax
+)
+{
+  const Digit3D *digits[RENDER3D_FACES_NUM][4]
+  = { [RENDER3D_FACE_DAYS]         = { clock->days_leftDigitA   , clock->days_leftDigitB   , clock->days_rightDigitA   , clock->days_rightDigitB    }
+    , [RENDER3D_FACE_HOURS]        = { clock->hours_leftDigitA  , clock->hours_leftDigitB  , clock->hours_rightDigitA  , clock->hours_rightDigitB   }
+    , [RENDER3D_FACE_MINUTES]      = { clock->minutes_leftDigitA, clock->minutes_leftDigitB, clock->minutes_rightDigitA, clock->minutes_rightDigitB }
+    , [RENDER3D_FACE_SECONDS]      = { clock->seconds_leftDigit , clock->seconds_rightDigit }
+    , [RENDER3D_FACE_SECOND100THS] = { clock->second100ths_leftDigit, clock->second100ths_rightDigit }
+    } ;
+  const RadialDial3D *radials[RENDER3D_FACES_NUM]
+  = { [RENDER3D_FACE_HOURS]        = clock->hours_radial
+    , [RENDER3D_FACE_MINUTES]      = clock->minutes_radial
+    , [RENDER3D_FACE_SECONDS]      = clock->seconds_radial
+#ifdef CLOCK3D_SECOND100THS_RADIAL
+    , [RENDER3D_FACE_SECOND100THS] = clock->second100ths_radial
+#endif
+    } ;
+  uint16_t faceEdges[RENDER3D_FACES_NUM] ;
+
+  *batchesMax = 1 ;   // Cube.
+
+  for ( uint8_t f = 0  ;  f < RENDER3D_FACES_NUM  ;  ++f )
+  {
+    faceEdges[f] = Render3D_radialEdges( radials[f] ) ;
+    *batchesMax += (radials[f] != NULL) ;
+
+    for ( uint8_t d = 0  ;  d < 4  ;  ++d )
+    {
+      faceEdges[f] += Render3D_digitEdgesMax( digits[f][d] ) ;
+      *batchesMax  += (digits[f][d] != NULL) ;
+    }
+  }
+
+  // Largest faces first.
+  for ( uint8_t f = 1  ;  f < RENDER3D_FACES_NUM  ;  ++f )
+    for ( uint8_t g = f  ;  g > 0  &&  faceEdges[g-1] < faceEdges[g]  ;  --g )
+    {
+      const uint16_t t = faceEdges[g] ;
+      faceEdges[g]     = faceEdges[g-1] ;
+      faceEdges[g-1]   = t ;
+    }
+
+  const uint8_t facesSeen = (transparency == MESH_TRANSPARENCY_SOLID) ? 3 : RENDER3D_FACES_NUM ;
+  uint16_t      segments  = (clock->cube != NULL  &&  clock->cube->edgeInfo != NULL) ? clock->cube->edgeInfo->edgesNum : 0 ;
+
+  for ( uint8_t f = 0  ;  f < facesSeen  ;  ++f )
+    segments += faceEdges[f] ;
+
+  return segments ;
+}
+
+
+void
+Render3D_clock
+( DisplayList            *list
+, Clock3D                *clock
+, const CamR3            *cam
+, const int               w
+, const int               h
+, const MeshTransparency  transparency
+)
+{
+  uint8_t lod ;
+
+  Clip2D_beginFrame( w, h ) ;
+  DisplayList_begin( list, w, h ) ;
+  s_stats.segmentsDrawn = 0 ;
+  s_stats.meshesCulled  = 0 ;
+
+  Render3D_mesh( list, clock->cube, cam, w, h, transparency, RENDER3D_LOD_FULL ) ;
+
+  lod = Render3D_faceLOD( RENDER3D_FACE_DAYS, clock->days_leftDigitA, cam, w, h ) ;
+  Render3D_digit ( list, clock->days_leftDigitA            , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->days_leftDigitB            , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->days_rightDigitA           , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->days_rightDigitB           , cam, w, h, transparency, lod ) ;
+
+  lod = Render3D_faceLOD( RENDER3D_FACE_HOURS, clock->hours_leftDigitA, cam, w, h ) ;
+  Render3D_digit ( list, clock->hours_leftDigitA           , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->hours_leftDigitB           , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->hours_rightDigitA          , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->hours_rightDigitB          , cam, w, h, transparency, lod ) ;
+  Render3D_radial( list, clock->hours_radial               , cam, w, h, transparency ) ;
+
+  lod = Render3D_faceLOD( RENDER3D_FACE_MINUTES, clock->minutes_leftDigitA, cam, w, h ) ;
+  Render3D_digit ( list, clock->minutes_leftDigitA         , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->minutes_leftDigitB         , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->minutes_rightDigitA        , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->minutes_rightDigitB        , cam, w, h, transparency, lod ) ;
+  Render3D_radial( list, clock->minutes_radial             , cam, w, h, transparency ) ;
+
+  lod = Render3D_faceLOD( RENDER3D_FACE_SECONDS, clock->seconds_leftDigit, cam, w, h ) ;
+  Render3D_digit ( list, clock->seconds_leftDigit          , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->seconds_rightDigit         , cam, w, h, transparency, lod ) ;
+  Render3D_radial( list, clock->seconds_radial             , cam, w, h, transparency ) ;
+
+  lod = Render3D_faceLOD( RENDER3D_FACE_SECOND100THS, clock->second100ths_leftDigit, cam, w, h ) ;
+  Render3D_digit ( list, clock->second100ths_leftDigit     , cam, w, h, transparency, lod ) ;
+  Render3D_digit ( list, clock->second100ths_rightDigit    , cam, w, h, transparency, lod ) ;
+#ifdef CLOCK3D_SECOND100THS_RADIAL
+  if (!s_isSecond100thsRadialHidden)
+    Render3D_radial( list, clock->second100ths_radial      , cam, w, h, transparency ) ;
+#endif
+
+  LOGD( "Render3D_clock:: meshes culled = %d, segments = %d, edges accepted = %d, clipped = %d, rejected = %d"
+      , s_stats.meshesCulled
+      , s_stats.segmentsDrawn
+      , Clip2D_getStats( )->accepted
+      , Clip2D_getStats( )->clipped
+      , Clip2D_getStats( )->rejected
+      ) ;
+}
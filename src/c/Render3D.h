@@ -0,0 +1,92 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Render3D.h
+   Author   : agent
+
+   Last revision: 12h56 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/CamR3.h>
+#include <karambola/MeshR3.h>
+#include <karambola/Clock3D.h>
+#include "DisplayList.h"
+
+
+typedef enum { RENDER3D_FACE_DAYS
+             , RENDER3D_FACE_HOURS
+             , RENDER3D_FACE_MINUTES
+             , RENDER3D_FACE_SECONDS
+             , RENDER3D_FACE_SECOND100THS
+             , RENDER3D_FACES_NUM
+             }
+Render3D_Face ;
+
+
+// Level of detail, picked at draw time from the edges the face mesh already has:
+// LOD N merges chained edges (polyline runs) up to 2^N at a time, where the screen path stays within
+// RENDER3D_LOD_TOLERANCE_PX of the merged chord. QUARTER also drops the alternate stroke layer of skin & bone digits.
+#define  RENDER3D_LOD_FULL     0
+#define  RENDER3D_LOD_HALF     1
+#define  RENDER3D_LOD_QUARTER  2
+
+#define  RENDER3D_RUN_MAX             (1 << RENDER3D_LOD_QUARTER)
+#define  RENDER3D_LOD_TOLERANCE_PX    1
+
+// Projected face size (pixels) below which a face drops to the next coarser LOD.
+#define  RENDER3D_LOD_HALF_BELOW_PX      40
+#define  RENDER3D_LOD_QUARTER_BELOW_PX   20
+#define  RENDER3D_LOD_HYSTERESIS_PX       4
+
+
+typedef struct
+{ uint8_t   faceLOD[RENDER3D_FACES_NUM] ;   // LOD selected for each clock face on the last frame.
+  uint16_t  lodChanges ;                    // LOD transitions since start.
+  uint16_t  segmentsDrawn ;                 // Last frame.
+  uint8_t   meshesCulled ;                  // Last frame: meshes whose bounding sphere was outside the frustum.
+} Render3D_Stats ;
+
+
+void  Render3D_initialize( ) ;
+void  Render3D_finalize  ( ) ;
+
+const Render3D_Stats*  Render3D_getStats( ) ;
+
+// Quality knobs (see Quality.h).
+void  Render3D_setStrokeWidthMax             ( const uint8_t strokeWidthMax ) ;   // 0: meshes own stroke widths.
+void  Render3D_setSecond100thsRadialHidden   ( const bool    isHidden       ) ;
+
+// Display list capacities (see DisplayList_new( )) for the configured clock: segments for the cube plus, per face,
+// its radial and the largest lit edge count of each digit over every type up to its typeMax.
+// SOLID: a cube shows at most 3 faces.
+uint16_t  Render3D_segmentsMax( const Clock3D *clock, const MeshTransparency transparency, uint16_t *batchesMax ) ;
+
+// Once per screen size, before the first replay: measures the projection on a package MeshR3_draw( ) of mesh
+// (see CamR3_Projection_calibrate( )). True if it changed, and so the lists are to be projected again.
+bool  Render3D_calibrate( GContext *gCtx, MeshR3 *mesh, const CamR3 *cam, const int w, const int h ) ;
+
+// Same visibility rules as MeshR3_draw( ) but, instead of drawing, each mesh is emitted as a single display list batch.
+void
+Render3D_mesh
+( DisplayList            *list
+, MeshR3                 *mesh
+, const CamR3            *cam
+, const int               w
+, const int               h
+, const MeshTransparency  transparency
+, const uint8_t           lod
+) ;
+
+// Builds the display list of a whole frame (Clock3D_draw( ) replacement, minus the raster pass: see DisplayList_draw( )).
+// Selects each face LOD from its projected size.
+void
+Render3D_clock
+( DisplayList            *list
+, Clock3D                *clock
+, const CamR3            *cam
+, const int               w
+, const int               h
+, const MeshTransparency  transparency
+) ;
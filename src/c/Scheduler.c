@@ -0,0 +1,271 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Scheduler.c
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#include <pebble.h>
+#include "Scheduler.h"
+#include "Wakeups.h"
+#include "TimeMs.h"
+#include "Config.h"
+
+
+// A package blinker transition, running on one of our AppTimers (the Blinker still owns it, see Scheduler.h).
+typedef struct
+{ AppTimer *timer ;
+  uint32_t  due_ms ;
+} Scheduler_Blink ;
+
+
+static SchedulerHandler  s_onFrame = NULL ;
+static SchedulerHandler  s_onBlink = NULL ;
+
+static AppTimer         *s_timer = NULL ;
+static uint32_t          s_timerDue_ms ;
+
+static bool              s_isFramePending = false ;
+static uint32_t          s_frameDue_ms ;
+
+static Scheduler_Blink   s_blinks[SCHEDULER_BLINKERS_MAX] ;
+static uint8_t           s_blinksNum = 0 ;
+
+
+// Wrap safe "a is before b".
+static inline
+bool
+Scheduler_isBefore
+( const uint32_t a
+, const uint32_t b
+)
+{ return (int32_t)(a - b) < 0 ; }
+
+
+// Is due_ms close enough to the pending frame to be moved onto it ?
+static inline
+bool
+Scheduler_isNearFrame
+( const uint32_t due_ms )
+{
+  return s_isFramePending
+     &&  !Scheduler_isBefore( due_ms, s_frameDue_ms - SCHEDULER_SLACK_MS )
+     &&  !Scheduler_isBefore( s_frameDue_ms + SCHEDULER_SLACK_MS, due_ms ) ;
+}
+
+
+static void  Scheduler_timer_handler( void *data ) ;
+
+
+// (Re)arms the frame AppTimer.
+static
+void
+Scheduler_arm
+( )
+{
+  if (!s_isFramePending)
+  {
+    if (s_timer != NULL)
+    {
+      app_timer_cancel( s_timer ) ;
+      s_timer = NULL ;
+    }
+
+    return ;
+  }
+
+  const uint32_t now_ms   = TimeMs_now( ) ;
+  const uint32_t delay_ms = Scheduler_isBefore( now_ms, s_frameDue_ms ) ? s_frameDue_ms - now_ms : 0 ;
+
+  if (s_timer != NULL  &&  s_timerDue_ms == s_frameDue_ms)
+    return ;
+
+  if (s_timer == NULL  ||  !app_timer_reschedule( s_timer, delay_ms ))
+    s_timer = app_timer_register( delay_ms, Scheduler_timer_handler, NULL ) ;
+
+  s_timerDue_ms = s_frameDue_ms ;
+}
+
+
+static
+void
+Scheduler_timer_handler
+( void *data )
+{
+  s_timer = NULL ;
+  Wakeups_count( WAKEUP_TIMER ) ;
+
+  if (!s_isFramePending)
+    return ;
+
+  s_isFramePending = false ;
+
+  if (s_onFrame != NULL)
+    s_onFrame( ) ;             // May schedule the next frame.
+}
+
+
+// Entries whose transition is past were cancelled by their Blinker (a fired one removes itself).
+static
+void
+Scheduler_blinkPrune
+( const uint32_t now_ms )
+{
+  for ( uint8_t i = 0  ;  i < s_blinksNum  ; )
+    if (Scheduler_isBefore( s_blinks[i].due_ms + SCHEDULER_SLACK_MS, now_ms ))
+      s_blinks[i] = s_blinks[--s_blinksNum] ;
+    else
+      ++i ;
+}
+
+
+static
+int
+Scheduler_blinkFind
+( const AppTimer *timer )
+{
+  for ( uint8_t i = 0  ;  i < s_blinksNum  ;  ++i )
+    if (s_blinks[i].timer == timer)
+      return i ;
+
+  return -1 ;
+}
+
+
+static void  Scheduler_blink_handler( void *data ) ;
+
+
+// Next transition of the blinker length_ms from now (moved onto the frame if near it), on our AppTimer.
+static
+bool
+Scheduler_blinkRegister
+( Blinker        *blinker
+, const uint32_t  length_ms
+)
+{
+  const uint32_t now_ms = TimeMs_now( ) ;
+  Scheduler_blinkPrune( now_ms ) ;
+
+  if (s_blinksNum == SCHEDULER_BLINKERS_MAX)
+    return false ;
+
+  const uint32_t due_ms = Scheduler_isNearFrame( now_ms + length_ms ) ? s_frameDue_ms : now_ms + length_ms ;
+  AppTimer      *timer  = app_timer_register( Scheduler_isBefore( now_ms, due_ms ) ? due_ms - now_ms : 0
+                                            , Scheduler_blink_handler, blinker
+                                            ) ;
+  if (timer == NULL)
+    return false ;
+
+  blinker->__appTimer     = timer ;
+  s_blinks[s_blinksNum++] = (Scheduler_Blink){ .timer = timer, .due_ms = due_ms } ;
+
+  return true ;
+}
+
+
+static inline
+uint32_t
+Scheduler_blinkLength
+( const Blinker *blinker )
+{ return (blinker->__state == BLINKER_ON) ? blinker->__lengthOn : blinker->__lengthOff ; }
+
+
+// The Blinker transition: done by the package handler itself, its next AppTimer then swapped for an aligned one.
+static
+void
+Scheduler_blink_handler
+( void *data )
+{
+  Blinker *blinker = data ;
+  Wakeups_count( WAKEUP_TIMER ) ;
+
+  const int i = Scheduler_blinkFind( blinker->__appTimer ) ;
+
+  if (i >= 0)
+    s_blinks[i] = s_blinks[--s_blinksNum] ;
+
+  Blinker_app_timer_handler( blinker ) ;
+  Scheduler_alignBlinker( blinker ) ;            // Its next transition, just registered by the package.
+
+  // The ink changed on a wakeup without a frame: re-project to show it.
+  if (!Scheduler_isNearFrame( TimeMs_now( ) )  &&  s_onBlink != NULL)
+    s_onBlink( ) ;
+}
+
+
+void
+Scheduler_initialize
+( SchedulerHandler onFrame
+, SchedulerHandler onBlink
+)
+{
+  s_onFrame = onFrame ;
+  s_onBlink = onBlink ;
+}
+
+
+void
+Scheduler_finalize
+( )
+{
+  // Blinkers are left running, on whichever AppTimer they are: Blinker_stop( ) cancels it.
+  s_isFramePending = false ;
+  s_blinksNum      = 0 ;
+  Scheduler_arm( ) ;            // Nothing due: cancels the timer.
+
+  s_onFrame = NULL ;
+  s_onBlink = NULL ;
+}
+
+
+void
+Scheduler_frame
+( const uint32_t delay_ms )
+{
+  const uint32_t now_ms = TimeMs_now( ) ;
+
+  s_isFramePending = true ;
+  s_frameDue_ms    = now_ms + delay_ms ;
+  Scheduler_arm( ) ;
+
+  // Blinker transitions near the new frame are moved onto it. Failing means fired or cancelled meanwhile.
+  for ( uint8_t i = 0  ;  i < s_blinksNum  ; )
+    if (s_blinks[i].due_ms == s_frameDue_ms  ||  !Scheduler_isNearFrame( s_blinks[i].due_ms ))
+      ++i ;
+    else if (app_timer_reschedule( s_blinks[i].timer, delay_ms ))
+      s_blinks[i++].due_ms = s_frameDue_ms ;
+    else
+      s_blinks[i] = s_blinks[--s_blinksNum] ;
+}
+
+
+void
+Scheduler_cancelFrame
+( )
+{
+  s_isFramePending = false ;
+  Scheduler_arm( ) ;
+}
+
+
+bool
+Scheduler_isFramePending
+( )
+{ return s_isFramePending ; }
+
+
+void
+Scheduler_alignBlinker
+( Blinker *blinker )
+{
+  if (blinker == NULL  ||  blinker->__appTimer == NULL  ||  Scheduler_blinkFind( blinker->__appTimer ) >= 0)
+    return ;
+
+  // (Re)started by the package, on its own AppTimer: swapped for ours, the blink phase restarts from now.
+  // No room: left on the package AppTimer, unaligned.
+  AppTimer *timer = blinker->__appTimer ;
+
+  if (Scheduler_blinkRegister( blinker, Scheduler_blinkLength( blinker ) ))
+    app_timer_cancel( timer ) ;
+}
@@ -0,0 +1,40 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Scheduler.h
+   Author   : agent
+
+   Last revision: 13h00 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include <karambola/Blinker.h>
+
+
+// Frame timer, with the mesh ink Blinker transitions phase aligned on it.
+// Blinker transitions within SCHEDULER_SLACK_MS of a frame are moved onto that frame (early or late), so that
+// while animating they never cost a wakeup of their own. Package Blinkers stay package owned: each transition is
+// still done by Blinker_app_timer_handler( ) on the Blinker's own __appTimer, which is merely one registered here
+// (and rescheduled when a frame comes near it). Blinker_stop( ) cancels it as usual, and no Blinker is referenced
+// once its timer is gone.
+
+#define  SCHEDULER_SLACK_MS        20    // Half a nominal frame interval.
+#define  SCHEDULER_BLINKERS_MAX     8     // Beyond that, Blinkers are left unaligned.
+
+
+typedef void (*SchedulerHandler)( ) ;
+
+
+// onFrame: the frame is due. onBlink: some ink changed on a wakeup without a frame (re-project to show it).
+void  Scheduler_initialize( SchedulerHandler onFrame, SchedulerHandler onBlink ) ;
+void  Scheduler_finalize  ( ) ;
+
+// Schedules the next frame delay_ms from now (replacing any pending one).
+void  Scheduler_frame          ( const uint32_t delay_ms ) ;
+void  Scheduler_cancelFrame    ( ) ;
+bool  Scheduler_isFramePending ( ) ;
+
+// A Blinker (re)started by the package, still on the AppTimer it registered: moved onto one aligned here, its
+// blink phase restarting from now. A no-op for Blinkers not running or already aligned.
+void  Scheduler_alignBlinker( Blinker *blinker ) ;
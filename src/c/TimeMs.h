@@ -0,0 +1,25 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : TimeMs.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+// Milliseconds wall clock (wraps every ~49 days): fine for measuring short intervals.
+static inline
+uint32_t
+TimeMs_now
+( )
+{
+  time_t   s ;
+  uint16_t ms ;
+  time_ms( &s, &ms ) ;
+
+  return (uint32_t)s * 1000 + ms ;
+}
@@ -0,0 +1,57 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Wakeups.c
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#include <pebble.h>
+#include "Wakeups.h"
+#include "Config.h"
+
+
+static Wakeups_Hour  s_thisHour ;
+static Wakeups_Hour  s_lastHour ;
+static time_t        s_hour      = 0 ;      // Hours since the epoch of s_thisHour.
+static bool          s_isPartial = true ;   // s_thisHour started mid hour (app start).
+
+
+void
+Wakeups_count
+( const Wakeup wakeup )
+{
+  const time_t hour = time( NULL ) / SECONDS_PER_HOUR ;
+
+  if (hour != s_hour)
+  {
+    // A partial first hour (app start) is not a representative sample.
+    if (!s_isPartial)
+    {
+      s_lastHour = (hour == s_hour + 1) ? s_thisHour : (Wakeups_Hour){ 0 } ;
+
+      LOGI( "Wakeups_count:: last hour timers = %d, ticks = %d, draws = %d, sensors = %d"
+          , s_lastHour.count[WAKEUP_TIMER], s_lastHour.count[WAKEUP_TICK], s_lastHour.count[WAKEUP_DRAW], s_lastHour.count[WAKEUP_SENSOR]
+          ) ;
+    }
+
+    s_isPartial = (s_hour == 0) ;
+    s_thisHour  = (Wakeups_Hour){ 0 } ;
+    s_hour      = hour ;
+  }
+
+  if (s_thisHour.count[wakeup] < UINT16_MAX)
+    ++s_thisHour.count[wakeup] ;
+}
+
+
+const Wakeups_Hour*
+Wakeups_thisHour
+( )
+{ return &s_thisHour ; }
+
+
+const Wakeups_Hour*
+Wakeups_lastHour
+( )
+{ return &s_lastHour ; }
@@ -0,0 +1,32 @@
+/*
+   WatchFace: Flip Clock 3D
+   File     : Wakeups.h
+   Author   : agent
+
+   Last revision: 12h50 October 18 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+// Callbacks the app is woken up for, counted per clock hour: compare idle cost between builds.
+typedef enum { WAKEUP_TIMER           // AppTimer callbacks.
+             , WAKEUP_TICK            // tick_timer_service callbacks.
+             , WAKEUP_DRAW            // Layer update procs.
+             , WAKEUP_SENSOR          // Accelerometer (data & tap) and battery callbacks.
+             , WAKEUPS_NUM
+             }
+Wakeup ;
+
+
+typedef struct
+{ uint16_t  count[WAKEUPS_NUM] ;
+} Wakeups_Hour ;
+
+
+void  Wakeups_count( const Wakeup wakeup ) ;
+
+const Wakeups_Hour*  Wakeups_thisHour( ) ;   // Counting so far.
+const Wakeups_Hour*  Wakeups_lastHour( ) ;   // Last complete clock hour (all zero until there is one).
@@ -17,6 +17,19 @@
 
 #include "main.h"
 #include "Config.h"
+#include "Draw2D_Batch.h"
+#include "Render3D.h"
+#include "DisplayList.h"
+#include "Quality.h"
+#include "Power.h"
+#include "CamR3_Spin.h"
+#include "QuaternionR3.h"
+#include "DigitSwitch.h"
+#include "RadialDial3D_Incremental.h"
+#include "Wakeups.h"
+#include "TimeMs.h"
+#include "Scheduler.h"
+#include "GPathFIFO_Ring.h"
 
 // Obstruction related.
 GSize unobstructed_screen ;
@@ -29,7 +42,17 @@ static Layer   *s_world_layer ;
 
 
 // World related
-static Clock3D s_clock ;  // The main/only world object.
+static Clock3D       s_clock ;                // The main/only world object.
+
+// Double buffered screen geometry: world_update( ) projects frame N+1 into the back list while world_draw( ) replays frame N (front).
+static DisplayList  *s_displayList[2]     = { NULL, NULL } ;
+static uint8_t       s_displayList_front  = 0 ;
+
+#define  DISPLAYLIST_FRONT  s_displayList[s_displayList_front]
+#define  DISPLAYLIST_BACK   s_displayList[s_displayList_front ^ 1]
+
+// Out of memory for the display lists: world_draw( ) draws straight through Clock3D_draw( ).
+#define  WORLD_ISRETAINED   (s_displayList[0] != NULL)
 
 
 typedef enum { WORLD_MODE_UNDEFINED
@@ -41,7 +64,6 @@ typedef enum { WORLD_MODE_UNDEFINED
 WorldMode ;
 
 static WorldMode  s_world_mode          = WORLD_MODE_UNDEFINED ;
-static AppTimer  *s_world_updateTimer   = NULL ;
 
 Sampler   *sampler_accelX = NULL ;            // To be allocated at world_initialize( ).
 Sampler   *sampler_accelY = NULL ;            // To be allocated at world_initialize( ).
@@ -76,7 +98,7 @@ static float    s_cam_zoom = PBL_IF_RECT_ELSE(1.25f, 1.14f) ;
 
 // Forward declarations.
 void  set_world_mode( const WorldMode pWorldMode ) ;
-void  world_update_timer_handler( void *data ) ;
+void  world_frame( ) ;
 void  clock_updateTime( ) ;
 
 
@@ -86,14 +108,149 @@ accel_data_service_handler
 ( AccelData *data
 , uint32_t   num_samples
 )
-{ }
+{ Wakeups_count( WAKEUP_SENSOR ) ; }
+
+
+// Accelerometer samplers: their running average is the DYNAMIC mode (unrotated) viewpoint.
+#define  ACCEL_STEADY_ATTRACTOR   (AccelData){ .x = -81, .y = -816, .z = -571 }   // STEADY viewPoint attractor.
+
+static
+void
+sampler_peek
+( AccelData *ad )
+{
+  if (accel_service_peek( ad ) < 0)                              // Accel service not available.
+    *ad = ACCEL_STEADY_ATTRACTOR ;
+#ifdef QEMU
+  else if (ad->x == 0  &&  ad->y == 0  &&  ad->z == -1000)       // Under QEMU with SENSORS off this is the default output.
+    *ad = ACCEL_STEADY_ATTRACTOR ;
+#endif
+}
+
+
+static
+void
+sampler_push
+( const AccelData *ad )
+{
+  Sampler_push( sampler_accelX, ad->x ) ;
+  Sampler_push( sampler_accelY, ad->y ) ;
+  Sampler_push( sampler_accelZ, ad->z ) ;
+}
+
+
+// Restarts the samplers average from a single sample.
+static
+void
+sampler_reset
+( const AccelData *ad )
+{
+  Sampler_init( sampler_accelX ) ;
+  Sampler_init( sampler_accelY ) ;
+  Sampler_init( sampler_accelZ ) ;
+  sampler_push( ad ) ;
+}
+
+
+// Squared standard error (g^2) of the viewpoint, from the spread of the samples currently averaged.
+static
+float
+sampler_noise2
+( )
+{
+  const Sampler *samplers[3] = { sampler_accelX, sampler_accelY, sampler_accelZ } ;
+  float          noise2      = 0.0f ;
+
+  for ( uint8_t a = 0  ;  a < 3  ;  ++a )
+  {
+    const Sampler *sampler = samplers[a] ;
+    const int      n       = sampler->samplesNum ;
+
+    if (n < 2)
+      continue ;
+
+    const float mean = (float)sampler->samplesAcum / n ;
+    float       var  = 0.0f ;
+
+    for ( int i = 0  ;  i < n  ;  ++i )
+      var += (sampler->samples[i] - mean) * (sampler->samples[i] - mean) ;
+
+    noise2 += var / ((n - 1) * n) ;      // Sample variance / n: variance of the average.
+  }
+
+  return 1e-6f * noise2 ;                // mg^2 -> g^2
+}
+
+
+static
+R3*
+sampler_viewPoint
+( R3 *viewPoint )
+{
+  const float kAvg = 0.001f / sampler_accelX->samplesNum ;
+
+  *viewPoint = (R3){ .x = kAvg * sampler_accelX->samplesAcum
+                   , .y =-kAvg * sampler_accelY->samplesAcum
+                   , .z =-kAvg * sampler_accelZ->samplesAcum
+                   } ;
+
+  return viewPoint ;
+}
 
 
 // Animation related
 static int    park_animStep    = -1 ;
-static float  park_animRange ;
 static int    launch_animStep  = -1 ;
 static float  launch_animRange = DEG_090 ;
+static int    s_flipSteps      = ANIMATION_FLIP_STEPS ;   // Steps the flip interpolation tables are built for.
+static int    s_spinSteps      = ANIMATION_SPIN_STEPS ;   // Same, spin (LAUNCH & PARK) table.
+
+
+// Nominal step counts are for ANIMATION_INTERVAL_MS frames: longer frame intervals (see Power.h) take fewer, bigger
+// steps, so that animations keep their wall clock duration.
+static
+int
+animation_steps
+( const int nominalSteps )
+{
+  const int steps = nominalSteps * ANIMATION_INTERVAL_MS / Power_getPolicy( )->frameInterval_ms ;
+
+  return (steps < 2) ? 2 : (steps > nominalSteps) ? nominalSteps : steps ;
+}
+
+
+// Rebuilt in place (allocated for the nominal steps). Only while no flip is in progress: the package indexes the
+// tables with its own animation steps.
+static
+void
+interpolations_flip
+( const int steps )
+{
+  if (steps == s_flipSteps)
+    return ;
+
+  Interpolator_AccelerateDecelerate( animRotationFraction, steps ) ;
+  Interpolator_SinYoYo( animTranslationFraction, steps ) ;
+  s_flipSteps = steps ;
+}
+
+
+// Same for the spin table, on LAUNCH & PARK entry. Returns the first step.
+static
+int
+interpolations_spin
+( )
+{
+  const int steps = animation_steps( ANIMATION_SPIN_STEPS ) ;
+
+  if (steps != s_spinSteps)
+  {
+    Interpolator_AccelerateDecelerate( spinRotationFraction, steps ) ;
+    s_spinSteps = steps ;
+  }
+
+  return steps ;
+}
 
 
 void
@@ -102,6 +259,8 @@ accel_tap_service_handler
 , int32_t        direction   // Direction is 1 or -1 (ignored)
 )
 {
+  Wakeups_count( WAKEUP_SENSOR ) ;
+
   switch (s_world_mode)
   {
     case WORLD_MODE_DYNAMIC:
@@ -118,7 +277,8 @@ accel_tap_service_handler
     break ;
 
     case WORLD_MODE_STEADY:
-      set_world_mode( WORLD_MODE_LAUNCH ) ;
+      if (Power_getPolicy( )->isTapLaunchAllowed)
+        set_world_mode( WORLD_MODE_LAUNCH ) ;
     break ;
 
     case WORLD_MODE_LAUNCH:
@@ -133,11 +293,14 @@ accel_tap_service_handler
 
 static
 void
-tick_timer_service_handler
-( struct tm *tick_time
-, TimeUnits  units_changed
-)
+world_tick
+( struct tm *tick_time )
 {
+  // Flips start here: their length follows the current power policy. STEADY flips are short bursts: each of their
+  // frames covers steadyFlipStepsPerFrame nominal steps, on a coarser table (fewer wakeups, same work per wakeup).
+  if (!Clock3D_isAnimated( &s_clock ))
+    interpolations_flip( animation_steps( ANIMATION_FLIP_STEPS / ((s_world_mode == WORLD_MODE_STEADY) ? Power_getPolicy( )->steadyFlipStepsPerFrame : 1) ) ) ;
+
   Clock3D_setTime_DDHHMMSS( &s_clock
                           , tick_time->tm_mday   // days
                           , tick_time->tm_hour   // hours
@@ -157,11 +320,28 @@ tick_timer_service_handler
      )
     set_world_mode( WORLD_MODE_PARK ) ;
 
+  // STEADY: this tick is the only wakeup, the frame is updated right away. A flip burst, if any, follows on the frame
+  // timer (already running if a burst is in progress: it picks the new time up).
+  if (s_world_mode == WORLD_MODE_STEADY)
+  {
+    if (!Scheduler_isFramePending( ))
+      world_frame( ) ;
+  }
   // Trigger call to world update. Will launch dynamic mode if needed.
-  if (s_world_updateTimer != NULL)
-    app_timer_reschedule( s_world_updateTimer, 0 ) ;                           // Reschedule next world update.
   else
-    s_world_updateTimer = app_timer_register( 0, world_update_timer_handler, NULL ) ;   // Schedule next world update.
+    Scheduler_frame( 0 ) ;
+}
+
+
+static
+void
+tick_timer_service_handler
+( struct tm *tick_time
+, TimeUnits  units_changed
+)
+{
+  Wakeups_count( WAKEUP_TICK ) ;
+  world_tick( tick_time ) ;
 }
 
 
@@ -171,14 +351,63 @@ clock_updateTime
 {
   time_t now ;
   time( &now ) ;
-  tick_timer_service_handler( localtime( &now ), 0 ) ;        // To set s_clock digits & dials with current time.
+  world_tick( localtime( &now ) ) ;        // To set s_clock digits & dials with current time.
 }
 
 
+// 100ths of second face, from the millisecond wall clock: no drift with frame jitter, and the meshes
+// are only touched when the displayed value changes (at most every second100thsInterval_ms, see Power.h).
+static
 void
-cam_config
-( const R3   *pViewPoint
-, const float pRotZrad
+clock_second100ths_update
+( )
+{
+  static uint32_t  lastUpdate_ms = 0 ;
+  const  uint32_t  now_ms        = TimeMs_now( ) ;
+  const  uint16_t  interval_ms   = Power_getPolicy( )->second100thsInterval_ms ;
+
+  if (interval_ms > 0  &&  now_ms - lastUpdate_ms < interval_ms)
+    return ;
+
+  // Taken from the wall clock itself: TimeMs_now( ) wraps at 2^32 ms, not on a second boundary.
+  uint16_t ms ;
+  time_ms( NULL, &ms ) ;
+
+  const int8_t second100ths = ms / 10 ;
+
+  if (second100ths == s_clock.second100ths)
+    return ;
+
+  lastUpdate_ms         = now_ms ;
+  s_clock.second100ths = second100ths ;
+
+  Digit3D_setValue( s_clock.second100ths_leftDigit , second100ths / 10 ) ;
+  Digit3D_setValue( s_clock.second100ths_rightDigit, second100ths % 10 ) ;
+#ifdef CLOCK3D_SECOND100THS_RADIAL
+  RadialDial3D_setValueIncremental( s_clock.second100ths_radial, second100ths ) ;
+#endif
+}
+
+
+// Camera fast path: while the (unrotated) viewpoint stays put, a new Z rotation is applied incrementally.
+// "Put" is within 3 standard errors of the sampler average (the drift accelerometer noise alone produces), bounded by
+// a floor (noiseless samples: QEMU, watch at rest on a table) and a ceiling (~1.7 degree view direction error).
+#define  CAM3D_VIEWPOINT_DRIFT_MIN     0.005f              // g
+#define  CAM3D_VIEWPOINT_DRIFT_MAX     0.030f              // g
+#define  CAM3D_ORTHONORMALIZE_STEPS    32                  // Incremental rotations between re-orthonormalizations.
+
+static bool   s_cam_isBuilt            = false ;
+static R3     s_cam_viewPoint ;                           // Unrotated viewpoint of the last full rebuild.
+static float  s_cam_rotZrad ;                             // Current rotation around Z.
+static int    s_cam_incrementalSteps   = 0 ;
+
+
+static
+void
+cam_build
+( CamR3       *pCam
+, const R3    *pViewPoint
+, const float  pRotZrad
 )
 {
   R3 scaledVP ;
@@ -188,7 +417,114 @@ cam_config
   R3_rotZrad( &rotatedVP, &scaledVP, pRotZrad ) ;
 
   // setup 3D camera
-  CamR3_lookAtOriginUpwards( &s_cam, &rotatedVP, s_cam_zoom, CAM_PROJECTION_PERSPECTIVE ) ;
+  CamR3_lookAtOriginUpwards( pCam, &rotatedVP, s_cam_zoom, CAM_PROJECTION_PERSPECTIVE ) ;
+}
+
+
+void
+cam_config
+( const R3   *pViewPoint
+, const float pRotZrad
+)
+{
+  if (s_cam_isBuilt)
+  {
+    R3 drift ;
+    R3_sub( &drift, pViewPoint, &s_cam_viewPoint ) ;
+
+    const float noise2    = 9.0f * sampler_noise2( ) ;
+    const float drift2Max = (noise2 < CAM3D_VIEWPOINT_DRIFT_MIN * CAM3D_VIEWPOINT_DRIFT_MIN) ? CAM3D_VIEWPOINT_DRIFT_MIN * CAM3D_VIEWPOINT_DRIFT_MIN
+                          : (noise2 > CAM3D_VIEWPOINT_DRIFT_MAX * CAM3D_VIEWPOINT_DRIFT_MAX) ? CAM3D_VIEWPOINT_DRIFT_MAX * CAM3D_VIEWPOINT_DRIFT_MAX
+                          : noise2 ;
+
+    if (R3_dotProduct( &drift, &drift ) < drift2Max)
+    {
+      const float deltaRotZrad = pRotZrad - s_cam_rotZrad ;
+
+      if (deltaRotZrad != 0.0f)
+      {
+        CamR3_rotateZ( &s_cam, FastMath_sin( deltaRotZrad ), FastMath_cos( deltaRotZrad ) ) ;
+        s_cam_rotZrad = pRotZrad ;
+
+        if (++s_cam_incrementalSteps == CAM3D_ORTHONORMALIZE_STEPS)
+        {
+          CamR3_orthonormalize( &s_cam, CAM3D_DISTANCEFROMORIGIN ) ;
+          s_cam_incrementalSteps = 0 ;
+        }
+      }
+
+      return ;
+    }
+  }
+
+  // Full rebuild.
+  s_cam_isBuilt          = true ;
+  s_cam_viewPoint        = *pViewPoint ;
+  s_cam_rotZrad          = pRotZrad ;
+  s_cam_incrementalSteps = 0 ;
+
+  cam_build( &s_cam, pViewPoint, pRotZrad ) ;
+}
+
+
+// LAUNCH & PARK camera: the tilt (unrotated viewpoint) is slerped between precomputed start & end cameras, the rotation
+// around Z is then interpolated as a plain angle: same direction & range as the spin it winds up or unwinds, even past
+// half a turn (the shortest arc would take it the other way round).
+static CamR3_Transition  s_cam_transition ;
+static R3                s_cam_transitionFromVP ;
+static R3                s_cam_transitionToVP ;
+static float             s_cam_transitionRotZrad ;        // Start rotation.
+static float             s_cam_transitionRangeRad ;       // End - start rotation.
+
+
+static
+void
+cam_transition_begin
+( const R3    *pFromViewPoint
+, const float  pFromRotZrad
+, const R3    *pToViewPoint
+, const float  pToRotZrad
+)
+{
+  CamR3 from, to ;
+  cam_build( &from, pFromViewPoint, 0.0f ) ;
+  cam_build( &to  , pToViewPoint  , 0.0f ) ;
+  CamR3_Transition_begin( &s_cam_transition, &from, &to ) ;
+
+  s_cam_transitionFromVP   = *pFromViewPoint ;
+  s_cam_transitionToVP     = *pToViewPoint ;
+  s_cam_transitionRotZrad  = pFromRotZrad ;
+  s_cam_transitionRangeRad = pToRotZrad - pFromRotZrad ;
+}
+
+
+// LAUNCH follows the gravity average as it builds up: the end camera is re-derived once it drifts off.
+static
+void
+cam_transition_retarget
+( const R3 *pToViewPoint )
+{
+  R3 drift ;
+  R3_sub( &drift, pToViewPoint, &s_cam_transitionToVP ) ;
+
+  if (R3_dotProduct( &drift, &drift ) < CAM3D_VIEWPOINT_DRIFT_MAX * CAM3D_VIEWPOINT_DRIFT_MAX)
+    return ;
+
+  const R3 fromVP = s_cam_transitionFromVP ;
+  cam_transition_begin( &fromVP, s_cam_transitionRotZrad, pToViewPoint, s_cam_transitionRotZrad + s_cam_transitionRangeRad ) ;
+}
+
+
+static
+void
+cam_transition_step
+( const float t )
+{
+  const float rotZrad = s_cam_transitionRotZrad + t * s_cam_transitionRangeRad ;
+
+  CamR3_Transition_step( &s_cam_transition, &s_cam, t, CAM3D_DISTANCEFROMORIGIN ) ;
+  CamR3_rotateZ( &s_cam, FastMath_sin( rotZrad ), FastMath_cos( rotZrad ) ) ;
+  s_cam_isBuilt = false ;   // Next cam_config( ) does a full rebuild.
 }
 
 
@@ -205,7 +541,7 @@ set_world_mode
   switch (s_world_mode = pWorldMode)
   {
     case WORLD_MODE_LAUNCH:
-      launch_animStep = ANIMATION_SPIN_STEPS ;
+      launch_animStep = interpolations_spin( ) ;
 
       // Gravity aware.
      	accel_data_service_subscribe( 0, accel_data_service_handler ) ;
@@ -214,6 +550,19 @@ set_world_mode
       tick_timer_service_subscribe( SECOND_UNIT, tick_timer_service_handler ) ;
 
       clock_updateTime( ) ;
+
+      // From the STEADY camera to the gravity viewpoint, DYNAMIC will start from there. The samplers keep their history:
+      // the average takes one more sample per frame, as the end camera follows it (see cam_transition_retarget( )).
+      {
+        AccelData ad ;
+        sampler_peek( &ad ) ;
+        sampler_push( &ad ) ;
+
+        R3 viewPoint ;
+        cam_transition_begin( &CAM3D_VIEWPOINT_STEADY    , SPIN_ROTATION_STEADY
+                            , sampler_viewPoint( &viewPoint ), SPIN_ROTATION_STEADY + launch_animRange
+                            ) ;
+      }
     break ;
 
     case WORLD_MODE_DYNAMIC:
@@ -221,8 +570,15 @@ set_world_mode
     break ;
 
     case WORLD_MODE_PARK:
-      park_animStep  = ANIMATION_SPIN_STEPS ;
-      park_animRange = s_spin_rotation - SPIN_ROTATION_STEADY ;    // From current rotation.
+      park_animStep = interpolations_spin( ) ;
+
+      // From the current viewpoint & rotation: the spin is unwound over its whole range, as it was wound.
+      {
+        R3 viewPoint ;
+        cam_transition_begin( sampler_viewPoint( &viewPoint ), s_spin_rotation
+                            , &CAM3D_VIEWPOINT_STEADY        , SPIN_ROTATION_STEADY
+                            ) ;
+      }
     break ;
 
     case WORLD_MODE_STEADY:
@@ -237,8 +593,8 @@ set_world_mode
                 , s_spin_rotation = SPIN_ROTATION_STEADY   // ViewPoint rotation around Z axis.
                 ) ;
 
-      // Activate on-minute-change s_clock updates.
-      tick_timer_service_subscribe( MINUTE_UNIT, tick_timer_service_handler ) ;
+      // Activate on-minute-change s_clock updates (on-second-change if the power policy allows).
+      tick_timer_service_subscribe( Power_getPolicy( )->steadyTickUnit, tick_timer_service_handler ) ;
     break ;
 
     default:
@@ -249,17 +605,27 @@ set_world_mode
 }
 
 
+void
+power_tier_change_handler
+( const PowerTier pPowerTier )
+{
+  // Only the STEADY tick unit needs re-subscribing, other policy items are read on every use.
+  if (s_world_mode == WORLD_MODE_STEADY)
+    tick_timer_service_subscribe( Power_getPolicy( )->steadyTickUnit, tick_timer_service_handler ) ;
+}
+
+
 static
 void
 interpolations_initialize
 ( )
 {
   Interpolator_AccelerateDecelerate( spinRotationFraction = malloc((ANIMATION_SPIN_STEPS+1)*sizeof(float))
-                                   , ANIMATION_SPIN_STEPS
+                                   , s_spinSteps = ANIMATION_SPIN_STEPS
                                    ) ;
 
   Interpolator_AccelerateDecelerate( animRotationFraction = malloc((ANIMATION_FLIP_STEPS+1)*sizeof(float))
-                                   , ANIMATION_FLIP_STEPS
+                                   , s_flipSteps = ANIMATION_FLIP_STEPS
                                    ) ;
 
   Interpolator_SinYoYo( animTranslationFraction = malloc((ANIMATION_FLIP_STEPS+1)*sizeof(float))
@@ -277,12 +643,31 @@ sampler_initialize
   sampler_accelY = Sampler_new( ACCEL_SAMPLER_CAPACITY ) ;
   sampler_accelZ = Sampler_new( ACCEL_SAMPLER_CAPACITY ) ;
 
-  for ( int i = 0  ;  i < ACCEL_SAMPLER_CAPACITY  ;  ++i )
+  sampler_reset( &ACCEL_STEADY_ATTRACTOR ) ;
+}
+
+
+// Sized from the configured clock (largest digit types, see Render3D_segmentsMax( )).
+static
+void
+world_displayLists_new
+( )
+{
+  uint16_t       batchesMax ;
+  const uint16_t segmentsMax = Render3D_segmentsMax( &s_clock, TRANSPARENCY_DEFAULT, &batchesMax ) ;
+
+  s_displayList[0] = DisplayList_new( segmentsMax, batchesMax ) ;
+  s_displayList[1] = DisplayList_new( segmentsMax, batchesMax ) ;
+
+  if (s_displayList[0] != NULL  &&  s_displayList[1] != NULL)
   {
-    Sampler_push( sampler_accelX,  -81 ) ;   // STEADY viewPoint attractor.
-    Sampler_push( sampler_accelY, -816 ) ;   // STEADY viewPoint attractor.
-    Sampler_push( sampler_accelZ, -571 ) ;   // STEADY viewPoint attractor.
+    LOGI( "world_displayLists_new:: 2 x %d segments, %d batches", segmentsMax, batchesMax ) ;
+    return ;
   }
+
+  LOGE( "world_displayLists_new:: out of memory for %d segments, drawing directly", segmentsMax ) ;
+  s_displayList[0] = DisplayList_free( s_displayList[0] ) ;
+  s_displayList[1] = DisplayList_free( s_displayList[1] ) ;
 }
 
 
@@ -291,9 +676,13 @@ world_initialize
 ( )
 {
   Clock3D_initialize( &s_clock ) ;
+  Render3D_initialize( ) ;
   sampler_initialize( ) ;
   interpolations_initialize( ) ;
   Clock3D_config( &s_clock, DIGIT2D_CURVYSKIN ) ;
+  RadialDial3D_Incremental_initialize( &s_clock ) ;   // Learns the radial encodings, see RadialDial3D_Incremental.h.
+  Quality_initialize( &s_clock ) ;
+  world_displayLists_new( ) ;
 }
 
 
@@ -324,6 +713,9 @@ world_finalize
 ( )
 {
   Clock3D_finalize( &s_clock ) ;
+  Render3D_finalize( ) ;
+  s_displayList[0] = DisplayList_free( s_displayList[0] ) ;
+  s_displayList[1] = DisplayList_free( s_displayList[1] ) ;
   sampler_finalize( ) ;
   interpolations_finalize( ) ;
 }
@@ -333,63 +725,91 @@ world_finalize
 
 static
 void
-world_update
+sampler_update
 ( )
 {
-  Clock3D_updateAnimation( &s_clock, ANIMATION_FLIP_STEPS ) ;
+  AccelData ad ;
+  sampler_peek( &ad ) ;
+  sampler_push( &ad ) ;
+}
 
-  if (s_world_mode != WORLD_MODE_STEADY)
+
+// Project the world into screen space segments (back buffer): world_draw( ) will only replay them.
+
+static
+void
+world_project
+( )
+{
+  if (!WORLD_ISRETAINED)
   {
-    Clock3D_second100ths_update( &s_clock ) ;
+    layer_mark_dirty( s_world_layer ) ;
+    return ;
+  }
 
-    AccelData ad ;
+  Render3D_clock( DISPLAYLIST_BACK, &s_clock, &s_cam, unobstructed_screen.w, unobstructed_screen.h, TRANSPARENCY_DEFAULT ) ;
+  DisplayList_diff( DISPLAYLIST_BACK, DISPLAYLIST_FRONT ) ;
 
-    if ( accel_service_peek( &ad ) < 0          // Accel service not available.
-      || (s_world_mode == WORLD_MODE_PARK  &&  park_animStep < ACCEL_SAMPLER_CAPACITY)  // last frames of PARK.
-       )
-    {
-      Sampler_push( sampler_accelX,  -81 ) ;   // STEADY viewPoint attractor.
-      Sampler_push( sampler_accelY, -816 ) ;   // STEADY viewPoint attractor.
-      Sampler_push( sampler_accelZ, -571 ) ;   // STEADY viewPoint attractor.
-    }
-    else
-    {
-#ifdef QEMU
-      if (ad.x == 0  &&  ad.y == 0  &&  ad.z == -1000)   // Under QEMU with SENSORS off this is the default output.
-      {
-        Sampler_push( sampler_accelX,  -81 ) ;
-        Sampler_push( sampler_accelY, -816 ) ;
-        Sampler_push( sampler_accelZ, -571 ) ;
-      }
-      else
-      {
-        Sampler_push( sampler_accelX, ad.x ) ;
-        Sampler_push( sampler_accelY, ad.y ) ;
-        Sampler_push( sampler_accelZ, ad.z ) ;
-      }
-#else
-      Sampler_push( sampler_accelX, ad.x ) ;
-      Sampler_push( sampler_accelY, ad.y ) ;
-      Sampler_push( sampler_accelZ, ad.z ) ;
-#endif
-    }
+  // Identical frames are dropped: no need to redraw what is already on screen.
+  if (DISPLAYLIST_BACK->isChanged)
+  {
+    s_displayList_front ^= 1 ;
+
+    // this will queue a defered call to the world_draw( ) method.
+    layer_mark_dirty( s_world_layer ) ;
+  }
+}
+
+
+static uint16_t  s_frame_updateCost_ms = 0 ;   // Added to the world_draw( ) cost to feed the quality governor.
+
+static
+void
+world_update
+( )
+{
+  const uint32_t start_ms = TimeMs_now( ) ;
+
+  DigitSwitch_step( &s_clock ) ;   // Digit type switch in progress, if any.
 
-    // Adjust s_cam rotation.
-    float cam_rotation ;
+  // STEADY flips run on fewer, bigger steps: fewer wakeups per burst (see world_tick( )).
+  Clock3D_updateAnimation( &s_clock, s_flipSteps ) ;
 
+  if (s_world_mode != WORLD_MODE_STEADY)
+  {
+    clock_second100ths_update( ) ;
+
+    // Adjust s_cam.
     switch (s_world_mode)
     {
       case WORLD_MODE_LAUNCH:
         if (launch_animStep >= 0)
-          cam_rotation = SPIN_ROTATION_STEADY  +  (1.0 - spinRotationFraction[launch_animStep--]) * launch_animRange ;
+        {
+          R3 viewPoint ;
+          sampler_update( ) ;
+          cam_transition_retarget( sampler_viewPoint( &viewPoint ) ) ;
+          cam_transition_step( 1.0f - spinRotationFraction[launch_animStep--] ) ;
+        }
         else
         {
-          cam_rotation = s_spin_rotation = SPIN_ROTATION_STEADY + launch_animRange ;
+          s_spin_rotation = SPIN_ROTATION_STEADY + launch_animRange ;
           set_world_mode( WORLD_MODE_DYNAMIC ) ;
         }
       break ;
   
       case WORLD_MODE_DYNAMIC:
+      {
+        // Power policy may thin out accelerometer sampling: skipped frames keep the samplers current average.
+        static uint8_t accelPeekCountdown = 0 ;
+
+        if (accelPeekCountdown == 0)
+        {
+          sampler_update( ) ;
+          accelPeekCountdown = Power_getPolicy( )->accelPeekEvery ;
+        }
+
+        --accelPeekCountdown ;
+
         // Friction: gradualy decrease spin speed until it stops.
         if (s_spin_speed > 0)
           --s_spin_speed ;
@@ -397,58 +817,49 @@ world_update
         if (s_spin_speed != 0)
           s_spin_rotation = FastMath_normalizeAngleRad( s_spin_rotation + (float)s_spin_speed * SPIN_ROTATION_QUANTA ) ;
 
-        cam_rotation = s_spin_rotation ;
+        R3 viewPoint ;
+        cam_config( sampler_viewPoint( &viewPoint ), s_spin_rotation ) ;
+      }
       break ;
 
       case WORLD_MODE_PARK:
         if (park_animStep >= 0)
-          cam_rotation = SPIN_ROTATION_STEADY  +  spinRotationFraction[park_animStep--] * park_animRange ;
+          cam_transition_step( 1.0f - spinRotationFraction[park_animStep--] ) ;
         else
-        {
-          cam_rotation = SPIN_ROTATION_STEADY ;
-          set_world_mode( WORLD_MODE_STEADY ) ;
-        }
+          set_world_mode( WORLD_MODE_STEADY ) ;   // Sets the exact STEADY camera.
       break ;
   
       default:
-        cam_rotation = SPIN_ROTATION_STEADY ;
       break ;
     }
-
-    if (s_world_mode != WORLD_MODE_STEADY)
-    {
-      const float kAvg = 0.001f / sampler_accelX->samplesNum ;
-
-      cam_config( &(R3){ .x = kAvg * sampler_accelX->samplesAcum
-                       , .y =-kAvg * sampler_accelY->samplesAcum
-                       , .z =-kAvg * sampler_accelZ->samplesAcum
-                       }
-                , cam_rotation
-                ) ;
-    }
   }
 
-  // this will queue a defered call to the world_draw( ) method.
-  layer_mark_dirty( s_world_layer ) ;
+  world_project( ) ;
+
+  s_frame_updateCost_ms = TimeMs_now( ) - start_ms ;
 }
 
 
 void
-world_update_timer_handler
-( void *data )
+world_frame
+( )
 {
-  s_world_updateTimer = NULL ;
   world_update( ) ;
 
   // Call me again ?
-  if (s_world_mode != WORLD_MODE_STEADY  ||  Clock3D_isAnimated( &s_clock ))
+  if (s_world_mode != WORLD_MODE_STEADY  ||  Clock3D_isAnimated( &s_clock )  ||  DigitSwitch_isPending( ))
     // Schedule next world_update (next animation frame).
-    s_world_updateTimer = app_timer_register( ANIMATION_INTERVAL_MS
-                                            , world_update_timer_handler
-                                            , data
-                                            ) ;
+    Scheduler_frame( Power_getPolicy( )->frameInterval_ms ) ;
 }
 
+
+// A blinker transition on a wakeup without a frame: the inks are taken at projection.
+static
+void
+world_blink
+( )
+{ world_project( ) ; }
+
 #ifdef LOG
 static int world_draw_count = 0 ;
 #endif
@@ -460,13 +871,33 @@ world_draw
 )
 {
   LOGD( "world_draw:: count = %d", ++world_draw_count ) ;
+  Wakeups_count( WAKEUP_DRAW ) ;
+
+  const uint32_t start_ms = TimeMs_now( ) ;
 
   // Disable antialiasing if running under QEMU (crashes after a few frames otherwise).
 #ifdef QEMU
     graphics_context_set_antialiased( gCtx, false ) ;
+#else
+    graphics_context_set_antialiased( gCtx, Quality_isAntialiased( ) ) ;
 #endif
 
-  Clock3D_draw( gCtx, &s_clock, &s_cam, unobstructed_screen.w, unobstructed_screen.h, TRANSPARENCY_DEFAULT ) ;
+  if (WORLD_ISRETAINED)
+  {
+    // First frame on this screen size: the projection is measured against the package (which draws the cube here).
+    if (Render3D_calibrate( gCtx, s_clock.cube, &s_cam, unobstructed_screen.w, unobstructed_screen.h ))
+      Render3D_clock( DISPLAYLIST_FRONT, &s_clock, &s_cam, unobstructed_screen.w, unobstructed_screen.h, TRANSPARENCY_DEFAULT ) ;
+
+    Draw2D_beginFrame( gCtx ) ;
+    DisplayList_draw( gCtx, DISPLAYLIST_FRONT, unobstructed_screen.w, unobstructed_screen.h ) ;
+    Draw2D_endFrame( gCtx ) ;
+  }
+  else
+    Clock3D_draw( gCtx, &s_clock, &s_cam, unobstructed_screen.w, unobstructed_screen.h, TRANSPARENCY_DEFAULT ) ;
+
+  // Only animation frames compete for the ANIMATION_INTERVAL_MS budget.
+  if (s_world_mode != WORLD_MODE_STEADY  ||  Clock3D_isAnimated( &s_clock ))
+    Quality_frameCost( s_frame_updateCost_ms + (TimeMs_now( ) - start_ms) ) ;
 }
 
 
@@ -477,6 +908,18 @@ unobstructed_area_change_handler
 )
 {
   unobstructed_screen = layer_get_unobstructed_bounds( s_window_layer ).size ;
+
+  // Raster pass only: the front frame is re-centered, not re-projected.
+  layer_mark_dirty( s_world_layer ) ;
+}
+
+
+void
+unobstructed_area_did_change_handler
+( void *context )
+{
+  // Obstruction settled: re-project once for the final screen size.
+  world_project( ) ;
 }
 
 
@@ -493,12 +936,20 @@ window_load
   layer_add_child( s_window_layer, s_world_layer ) ;
 
   // Obstrution handling.
-  UnobstructedAreaHandlers unobstructed_area_handlers = { .change = unobstructed_area_change_handler } ;
+  UnobstructedAreaHandlers unobstructed_area_handlers = { .change     = unobstructed_area_change_handler
+                                                        , .did_change = unobstructed_area_did_change_handler
+                                                        } ;
   unobstructed_area_service_subscribe( unobstructed_area_handlers, NULL ) ;
 
   // Become tap aware.
   accel_tap_service_subscribe( accel_tap_service_handler ) ;
 
+  // Become battery aware.
+  Power_initialize( power_tier_change_handler ) ;
+
+  // Frame & blinker timer.
+  Scheduler_initialize( world_frame, world_blink ) ;
+
   // Set initial world mode.
   set_world_mode( WORLD_MODE_INITIAL ) ;
   clock_updateTime( ) ;
@@ -510,11 +961,7 @@ window_unload
 ( Window *s_window )
 {
   // Stop world animation.
-  if (s_world_updateTimer != NULL)
-  {
-    app_timer_cancel( s_world_updateTimer ) ;
-    s_world_updateTimer = NULL ;
-  }
+  Scheduler_finalize( ) ;
 
   unobstructed_area_service_unsubscribe( ) ;
 
@@ -527,6 +974,9 @@ window_unload
   // Tap unaware.
   accel_tap_service_unsubscribe( ) ;
 
+  // Battery unaware.
+  Power_finalize( ) ;
+
   layer_destroy( s_world_layer ) ;
 }
 
@@ -548,6 +998,11 @@ app_initialize
                             ) ;
 
   window_stack_push( s_window, false ) ;
+
+#ifdef BENCHMARK
+  DigitSwitch_benchmark( &s_clock ) ;
+  GPathFIFO_Ring_benchmark( ) ;
+#endif
 }
 
 